@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Number of frames of the rolling bandwidth windows.
+    */
+    constexpr std::size_t BANDWIDTH_WINDOW_FRAMES = 128;
+
+    /**
+     * @brief Number of message IDs.
+    */
+    constexpr std::size_t MAX_MESSAGE_IDS = 256;
+
+    /**
+     * @brief Number of accounted clients; index 0 accounts the messages with unknown recipients (PVS, PAS, init).
+    */
+    constexpr std::size_t MAX_ACCOUNTED_CLIENTS = 65;
+
+    /**
+     * @brief Bytes and number of sent messages.
+    */
+    struct MessageStats
+    {
+        std::uint64_t bytes{};
+        std::uint64_t count{};
+    };
+
+    /**
+     * @brief Starts accounting the outgoing network messages of all plugins and the game DLL.
+     *
+     * Messages are accounted by engine pre hooks with the lowest priority, so messages blocked by other
+     * hooks of this plugin are not counted. The size of a message is its payload plus one byte for its ID.
+     * A message to all clients is accounted to every connected client.
+     *
+     * @param dump_command Name of the server command that prints the statistics, or \c nullptr.
+     * Usage: <command> [count = 10] [reset]. Only the first command passed is added.
+    */
+    void EnableBandwidthAccounting(const char* dump_command = nullptr);
+
+    /**
+     * @brief Clears all statistics.
+    */
+    void ResetBandwidthAccounting();
+
+    /**
+     * @brief Messages sent to the client since the accounting was enabled or reset.
+     *
+     * @param client_index Entity index of the client, or 0 for the messages with unknown recipients.
+    */
+    MessageStats ClientBandwidth(int client_index);
+
+    /**
+     * @brief Messages with the given ID sent to the client since the accounting was enabled or reset.
+    */
+    MessageStats ClientBandwidth(int client_index, int msg_id);
+
+    /**
+     * @brief Messages sent to the client during the last \c BANDWIDTH_WINDOW_FRAMES frames.
+    */
+    MessageStats ClientWindowBandwidth(int client_index);
+
+    /**
+     * @brief Messages with the given ID sent since the accounting was enabled or reset.
+     * Unlike the client statistics, a message to several clients is counted once.
+    */
+    MessageStats MessageBandwidth(int msg_id);
+
+    /**
+     * @brief Messages with the given ID sent during the last \c BANDWIDTH_WINDOW_FRAMES frames.
+    */
+    MessageStats MessageWindowBandwidth(int msg_id);
+
+    /**
+     * @brief Messages sent during the current frame.
+    */
+    MessageStats FrameBandwidth();
+}
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <vector>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Returns the entities with the given class name, in no particular order.
+     *
+     * Replaces \c FindEntityByString(..., "classname", ...) loops: the entities are kept in one list per class
+     * name, maintained from the \c Spawn, \c CreateNamedEntity, \c ClientPutInServer and \c FreeEntityPrivateData
+     * hooks, so a query is a hash lookup and does not call the engine. Entities that the game DLL creates with
+     * \c CreateEntity (e.g. grenades) and bots are classified on the next call, once their class name is set.
+     * The index is built on the first call.
+     *
+     * @code
+     * for (auto* const bomb : metamod::engine::EntitiesByClass("weapon_c4")) {
+     *     // ...
+     * }
+     * @endcode
+     *
+     * @param class_name Class name; \c nullptr matches no entity.
+     *
+     * @return Live entities; the reference is valid until an entity of this class is created or freed.
+    */
+    const std::vector<cssdk::Edict*>& EntitiesByClass(const char* class_name);
+
+    /**
+     * @brief Moves the entity to the list of its current class name.
+     * Only needed if the class name of an entity is changed after it has spawned.
+    */
+    void UpdateClassIndex(cssdk::Edict* entity);
+}
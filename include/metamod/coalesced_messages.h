@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/message_builder.h>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Queues a message that supersedes the previous messages with the same client, ID and key.
+     *
+     * Only the last message queued for a (client, message ID, key) during a frame is sent: messages to a
+     * client are sent after its \c PlayerPostThink, the remaining messages after \c StartFrame.
+     * Messages to clients that are no longer connected are dropped.
+     *
+     * @code
+     * metamod::engine::MessageBuilder money{money_msg_id};
+     * money.WriteLong(amount).WriteByte(1);
+     * metamod::engine::SendCoalesced(money, client);
+     * @endcode
+     *
+     * @param message Message to send; its fields are copied.
+     * @param client Client to send the message to, or \c nullptr to send it to all clients.
+     * @param key Distinguishes messages with the same ID that do not supersede each other (e.g. the player
+     * index of a \c ScoreInfo message).
+     * @param reliable Whether the message is sent reliably.
+     * @param replay How the message is written to the engine.
+     *
+     * @note A message that overflowed is not queued; the error is logged.
+    */
+    void SendCoalesced(const MessageBuilder& message, cssdk::Edict* client, int key = 0, bool reliable = true,
+                       MessageReplay replay = MessageReplay::Auto);
+
+    /**
+     * @brief Sends all queued coalesced messages now.
+    */
+    void FlushCoalescedMessages();
+}
@@ -18,15 +18,34 @@
 #pragma once
 
 #include <cssdk/engine/eiface.h>
+#include <metamod/hook_chain.h>
+#include <metamod/hook_table.h>
 #include <cstring>
 #include <type_traits>
 
 namespace metamod::engine::detail
 {
-    inline cssdk::EngineFunctions* engine_hooks = new cssdk::EngineFunctions{};
-    inline cssdk::EngineFunctions* engine_post_hooks = new cssdk::EngineFunctions{};
+    /**
+     * @brief Static storage of the hook tables until they are exported to Metamod.
+    */
+    inline cssdk::EngineFunctions engine_hooks_storage{};
+    inline cssdk::EngineFunctions engine_post_hooks_storage{};
+
+    inline cssdk::EngineFunctions* engine_hooks = &engine_hooks_storage;
+    inline cssdk::EngineFunctions* engine_post_hooks = &engine_post_hooks_storage;
+
+    /**
+     * @brief Whether the table was empty at attach time and therefore not exported to Metamod.
+    */
+    inline bool engine_hooks_skipped{};
+    inline bool engine_post_hooks_skipped{};
 
-    inline void ClearEngineHooks()
+    /**
+     * @brief Clears the hook tables.
+     *
+     * @param remove_internal Whether to remove the hooks of the SDK facilities too, otherwise they are reinstalled.
+    */
+    inline void ClearEngineHooks(const bool remove_internal = false)
     {
         if (engine_hooks != nullptr) {
             // ReSharper disable once CppRedundantCastExpression
@@ -37,20 +56,51 @@ namespace metamod::engine::detail
             // ReSharper disable once CppRedundantCastExpression
             std::memset(static_cast<void*>(engine_post_hooks), 0, sizeof(cssdk::EngineFunctions));
         }
+
+        metamod::detail::ResetHookChains(engine_hooks, false, remove_internal);
+        metamod::detail::ResetHookChains(engine_post_hooks, true, remove_internal);
+    }
+
+    template <auto Member, typename TCallback>
+    void SetHook(const TCallback callback, const bool post, const int priority = 0, const bool internal = false)
+    {
+        if (post) {
+            assert(engine_post_hooks != nullptr);
+            metamod::detail::SetHook<Member, true>(engine_post_hooks, callback, priority, internal);
+            metamod::detail::CheckSkippedHookTable(engine_post_hooks_skipped, "engine post hooks");
+        }
+        else {
+            assert(engine_hooks != nullptr);
+            metamod::detail::SetHook<Member, false>(engine_hooks, callback, priority, internal);
+            metamod::detail::CheckSkippedHookTable(engine_hooks_skipped, "engine hooks");
+        }
     }
 
-    template <typename TMember, typename TCallback>
-    void SetHook(TMember cssdk::EngineFunctions::*member, const TCallback callback, const bool post)
+    template <auto Member, typename TCallback>
+    void RemoveHook(const TCallback callback, const bool post)
     {
         if (post) {
             assert(engine_post_hooks != nullptr);
-            engine_post_hooks->*member = callback;
+            metamod::detail::RemoveHook<Member, true>(engine_post_hooks, callback);
         }
         else {
             assert(engine_hooks != nullptr);
-            engine_hooks->*member = callback;
+            metamod::detail::RemoveHook<Member, false>(engine_hooks, callback);
         }
     }
+
+    inline void SetHookTable(const cssdk::EngineFunctions& table, const bool post)
+    {
+        auto* const hooks = post ? engine_post_hooks : engine_hooks;
+        assert(hooks != nullptr);
+
+        // The hooks of the SDK facilities are merged back into the new table.
+        *hooks = table;
+        metamod::detail::ResetHookChains(hooks, post);
+
+        metamod::detail::CheckSkippedHookTable(post ? engine_post_hooks_skipped : engine_hooks_skipped,
+                                               post ? "engine post hooks" : "engine hooks");
+    }
 }
 
 namespace metamod::engine
@@ -58,411 +108,446 @@ namespace metamod::engine
     /**
      * @brief Precaches a model.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookPrecacheModel(const std::add_pointer_t<int(const char* path)> callback, const bool post)
+    inline void HookPrecacheModel(const std::add_pointer_t<int(const char* path)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::precache_model, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::precache_model>(callback, post, priority);
     }
 
     /**
      * @brief Precaches a sound.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookPrecacheSound(const std::add_pointer_t<int(const char* path)> callback, const bool post)
+    inline void HookPrecacheSound(const std::add_pointer_t<int(const char* path)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::precache_sound, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::precache_sound>(callback, post, priority);
     }
 
     /**
      * @brief Sets the model of the given entity. Also changes the entity bounds based on the model.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSetModel(const std::add_pointer_t<void(cssdk::Edict* entity, const char* model)> callback, const bool post)
+    inline void HookSetModel(const std::add_pointer_t<void(cssdk::Edict* entity, const char* model)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_model, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_model>(callback, post, priority);
     }
 
     /**
      * @brief Gets the index of the given model.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookModelIndex(const std::add_pointer_t<int(const char* model)> callback, const bool post)
+    inline void HookModelIndex(const std::add_pointer_t<int(const char* model)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::model_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::model_index>(callback, post, priority);
     }
 
     /**
      * @brief Gets the number of frames in the given model.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookModelFrames(const std::add_pointer_t<int(int model_index)> callback, const bool post)
+    inline void HookModelFrames(const std::add_pointer_t<int(int model_index)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::model_frames, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::model_frames>(callback, post, priority);
     }
 
     /**
      * @brief Sets the entity bounds. Also relinks the entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetSize(
         const std::add_pointer_t<void(cssdk::Edict* entity, const cssdk::Vector& min, const cssdk::Vector& max)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_size, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_size>(callback, post, priority);
     }
 
     /**
      * @brief Changes the level. This will append a change level command to the server command buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookChangeLevel(
-        const std::add_pointer_t<void(const char* level_name, const char* landmark_name)> callback, const bool post)
+        const std::add_pointer_t<void(const char* level_name, const char* landmark_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::change_level, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::change_level>(callback, post, priority);
     }
 
     /**
      * @brief Does nothing useful. Will trigger a host error if the given entity is not a client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetSpawnParams(const std::add_pointer_t<void(cssdk::Edict* client)> callback, const bool post)
+    inline void HookGetSpawnParams(const std::add_pointer_t<void(cssdk::Edict* client)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_spawn_params, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_spawn_params>(callback, post, priority);
     }
 
     /**
      * @brief Does nothing useful. Will trigger a host error if the given entity is not a client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSaveSpawnParams(const std::add_pointer_t<void(cssdk::Edict* client)> callback, const bool post)
+    inline void HookSaveSpawnParams(const std::add_pointer_t<void(cssdk::Edict* client)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::save_spawn_params, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::save_spawn_params>(callback, post, priority);
     }
 
     /**
      * @brief Converts a direction vector to a yaw angle.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookVecToYaw(const std::add_pointer_t<float(const cssdk::Vector& direction)> callback, const bool post)
+    inline void HookVecToYaw(const std::add_pointer_t<float(const cssdk::Vector& direction)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::vec_to_yaw, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::vec_to_yaw>(callback, post, priority);
     }
 
     /**
      * @brief Converts a direction vector to angles.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookVecToAngles(
         const std::add_pointer_t<void(const cssdk::Vector& direction_in, cssdk::Vector& angles_out)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::vec_to_angles, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::vec_to_angles>(callback, post, priority);
     }
 
     /**
      * @brief Moves the given entity to the given destination.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookMoveToOrigin(
         const std::add_pointer_t<void(cssdk::Edict* entity, const cssdk::Vector& goal, float distance, cssdk::MoveTypeNpc move_type)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::move_to_origin, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::move_to_origin>(callback, post, priority);
     }
 
     /**
      * @brief Changes the entity's yaw angle to approach its ideal yaw.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookChangeYaw(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookChangeYaw(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::change_yaw, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::change_yaw>(callback, post, priority);
     }
 
     /**
      * @brief Changes the entity's pitch angle to approach its ideal pitch.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookChangePitch(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookChangePitch(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::change_pitch, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::change_pitch>(callback, post, priority);
     }
 
     /**
      * @brief Finds an entity by comparing strings.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookFindEntityByString(
         const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* edict_start_search_after, const char* field, const char* value)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::find_entity_by_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::find_entity_by_string>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetEntityIllumination(const std::add_pointer_t<int(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookGetEntityIllumination(const std::add_pointer_t<int(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_entity_illumination, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_entity_illumination>(callback, post, priority);
     }
 
     /**
      * @brief Finds an entity in a sphere.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookFindEntityInSphere(
         const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* edict_start_search_after, const cssdk::Vector& origin, float radius)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::find_entity_in_sphere, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::find_entity_in_sphere>(callback, post, priority);
     }
 
     /**
      * @brief Finds a client in the potentially visible set.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookFindClientInPvs(const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookFindClientInPvs(const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::find_client_in_pvs, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::find_client_in_pvs>(callback, post, priority);
     }
 
     /**
      * @brief Find entities in potentially visible set.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookEntitiesInPvs(const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookEntitiesInPvs(const std::add_pointer_t<cssdk::Edict*(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::entities_in_pvs, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::entities_in_pvs>(callback, post, priority);
     }
 
     /**
      * @brief Make direction vectors from angles.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookMakeVectors(const std::add_pointer_t<void(const cssdk::Vector& angles)> callback, const bool post)
+    inline void HookMakeVectors(const std::add_pointer_t<void(const cssdk::Vector& angles)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::make_vectors, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::make_vectors>(callback, post, priority);
     }
 
     /**
      * @brief Make direction vectors from angles.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookAngleVectors(const std::add_pointer_t<void(const cssdk::Vector& angles, cssdk::Vector& forward, cssdk::Vector& right, cssdk::Vector& up)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::angle_vectors, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::angle_vectors>(callback, post, priority);
     }
 
     /**
      * @brief Allocates an entity dictionary for use with an entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCreateEntity(const std::add_pointer_t<cssdk::Edict*()> callback, const bool post)
+    inline void HookCreateEntity(const std::add_pointer_t<cssdk::Edict*()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::create_entity, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::create_entity>(callback, post, priority);
     }
 
     /**
      * @brief Immediately removes the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookRemoveEntity(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookRemoveEntity(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::remove_entity, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::remove_entity>(callback, post, priority);
     }
 
     /**
      * @brief Creates an entity of the class \c class_name.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCreateNamedEntity(const std::add_pointer_t<cssdk::Edict*(cssdk::Strind class_name)> callback, const bool post)
+    inline void HookCreateNamedEntity(const std::add_pointer_t<cssdk::Edict*(cssdk::Strind class_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::create_named_entity, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::create_named_entity>(callback, post, priority);
     }
 
     /**
      * @brief Makes an entity inline. Static entities are copied to the client side and are removed on the server side.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookMakeStatic(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookMakeStatic(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::make_static, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::make_static>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookEntIsOnFloor(const std::add_pointer_t<cssdk::qboolean(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookEntIsOnFloor(const std::add_pointer_t<cssdk::qboolean(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::ent_is_on_floor, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::ent_is_on_floor>(callback, post, priority);
     }
 
     /**
      * @brief Drops the entity to the floor.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookDropToFloor(const std::add_pointer_t<int(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookDropToFloor(const std::add_pointer_t<int(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::drop_to_floor, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::drop_to_floor>(callback, post, priority);
     }
 
     /**
      * @brief Makes the entity walk.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookWalkMove(const std::add_pointer_t<cssdk::qboolean(cssdk::Edict* entity, float yaw, float dist, cssdk::WalkMoveMode mode)> callback,
-                             const bool post)
+                             const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::walk_move, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::walk_move>(callback, post, priority);
     }
 
     /**
      * @brief Sets the origin of the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetOrigin(const std::add_pointer_t<void(cssdk::Edict* entity, const cssdk::Vector& origin)> callback,
-                              const bool post)
+                              const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_origin, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_origin>(callback, post, priority);
     }
 
     /**
      * @brief Emits a sounds from the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEmitSound(
         const std::add_pointer_t<void(cssdk::Edict* entity, cssdk::SoundChannel channel, const char* sample, float volume, float attenuation, int flags, int pitch)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::emit_sound, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::emit_sound>(callback, post, priority);
     }
 
     /**
      * @brief Emits a sounds from the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEmitAmbientSound(
         const std::add_pointer_t<void(cssdk::Edict* entity, cssdk::Vector& origin, const char* sample, float volume, float attenuation, int flags, int pitch)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::emit_ambient_sound, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::emit_ambient_sound>(callback, post, priority);
     }
 
     /**
      * @brief Performs a trace between a starting and ending position.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceLine(
         const std::add_pointer_t<void(const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int trace_ignore_flags, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_line, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_line>(callback, post, priority);
     }
 
     /**
      * @brief Traces a toss.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceToss(const std::add_pointer_t<void(cssdk::Edict* entity, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
-                              const bool post)
+                              const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_toss, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_toss>(callback, post, priority);
     }
 
     /**
      * @brief Performs a trace between a starting and ending position, using the given entity's min size and max size.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceMonsterHull(
         const std::add_pointer_t<cssdk::qboolean(cssdk::Edict* entity, const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int trace_ignore_flags, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_monster_hull, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_monster_hull>(callback, post, priority);
     }
 
     /**
      * @brief Performs a trace between a starting and ending position, using the specified hull.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceHull(
         const std::add_pointer_t<void(const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int trace_ignore_flags, int hull_number, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_hull, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_hull>(callback, post, priority);
     }
 
     /**
@@ -471,1431 +556,1569 @@ namespace metamod::engine
      * Similar to \c trace_hull, but will instead perform a trace in the given world hull
      * using the given entity's model's hulls.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceModel(
         const std::add_pointer_t<void(const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int hull_number, cssdk::Edict* entity, cssdk::TraceResult* result)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_model, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_model>(callback, post, priority);
     }
 
     /**
      * @brief Used to get texture info.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceTexture(const std::add_pointer_t<const char*(cssdk::Edict* texture_entity, const cssdk::Vector& start_pos, const cssdk::Vector& end_pos)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_texture, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_texture>(callback, post, priority);
     }
 
     /**
      * @brief Not implemented. Triggers a sys error.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookTraceSphere(const std::add_pointer_t<void(const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int trace_ignore_flags, float radius, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
-                                const bool post)
+                                const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::trace_sphere, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::trace_sphere>(callback, post, priority);
     }
 
     /**
      * @brief Get the aim vector for the given entity.
      * Assumes \c MakeVectors was called with \c entity->vars.angles beforehand.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetAimVector(const std::add_pointer_t<void(cssdk::Edict* entity, float speed, cssdk::Vector& vec_return)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_aim_vector, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_aim_vector>(callback, post, priority);
     }
 
     /**
      * @brief Issues a command to the server.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookServerCommand(const std::add_pointer_t<void(const char* command)> callback, const bool post)
+    inline void HookServerCommand(const std::add_pointer_t<void(const char* command)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::server_command, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::server_command>(callback, post, priority);
     }
 
     /**
      * @brief Executes all pending server commands.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookServerExecute(const std::add_pointer_t<void()> callback, const bool post)
+    inline void HookServerExecute(const std::add_pointer_t<void()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::server_execute, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::server_execute>(callback, post, priority);
     }
 
     /**
      * @brief Sends a client command to the given client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     template <typename... TArgs>
     void HookClientCommand(const std::add_pointer_t<void(cssdk::Edict* client, const char* format, TArgs&&... args)> callback,
-                           const bool post)
+                           const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::client_command, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::client_command>(callback, post, priority);
     }
 
     /**
      * @brief Creates a particle effect.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookParticleEffect(const std::add_pointer_t<void(const cssdk::Vector& origin, const cssdk::Vector& direction, float color, float count)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::particle_effect, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::particle_effect>(callback, post, priority);
     }
 
     /**
      * @brief Sets the given light style to the given value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookLightStyle(const std::add_pointer_t<void(int style, const char* value)> callback, const bool post)
+    inline void HookLightStyle(const std::add_pointer_t<void(int style, const char* value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::light_style, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::light_style>(callback, post, priority);
     }
 
     /**
      * @brief Gets the index of the given decal.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookDecalIndex(const std::add_pointer_t<int(const char* name)> callback, const bool post)
+    inline void HookDecalIndex(const std::add_pointer_t<int(const char* name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::decal_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::decal_index>(callback, post, priority);
     }
 
     /**
      * @brief Gets the contents of the given location in the world.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookPointContents(const std::add_pointer_t<int(const cssdk::Vector& origin)> callback, const bool post)
+    inline void HookPointContents(const std::add_pointer_t<int(const cssdk::Vector& origin)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::point_contents, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::point_contents>(callback, post, priority);
     }
 
     /**
      * @brief Begins a new network message.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookMessageBegin(const std::add_pointer_t<void(cssdk::MessageType msg_type, int msg_id, const float* origin, cssdk::Edict* client)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::message_begin, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::message_begin>(callback, post, priority);
     }
 
     /**
      * @brief Ends a network message.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookMessageEnd(const std::add_pointer_t<void()> callback, const bool post)
+    inline void HookMessageEnd(const std::add_pointer_t<void()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::message_end, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::message_end>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single unsigned \c cssdk::byte.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteByte(const std::add_pointer_t<void(int value)> callback, const bool post)
+    inline void HookWriteByte(const std::add_pointer_t<void(int value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_byte, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_byte>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single character.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteChar(const std::add_pointer_t<void(int value)> callback, const bool post)
+    inline void HookWriteChar(const std::add_pointer_t<void(int value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_char, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_char>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single unsigned short.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteShort(const std::add_pointer_t<void(int value)> callback, const bool post)
+    inline void HookWriteShort(const std::add_pointer_t<void(int value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_short, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_short>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single unsigned int.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteLong(const std::add_pointer_t<void(int value)> callback, const bool post)
+    inline void HookWriteLong(const std::add_pointer_t<void(int value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_long, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_long>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single angle value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteAngle(const std::add_pointer_t<void(float value)> callback, const bool post)
+    inline void HookWriteAngle(const std::add_pointer_t<void(float value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_angle, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_angle>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single coordinate value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteCoord(const std::add_pointer_t<void(float value)> callback, const bool post)
+    inline void HookWriteCoord(const std::add_pointer_t<void(float value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_coord, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_coord>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single null terminated string.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteString(const std::add_pointer_t<void(const char* value)> callback, const bool post)
+    inline void HookWriteString(const std::add_pointer_t<void(const char* value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_string>(callback, post, priority);
     }
 
     /**
      * @brief Writes a single entity index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookWriteEntity(const std::add_pointer_t<void(int value)> callback, const bool post)
+    inline void HookWriteEntity(const std::add_pointer_t<void(int value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::write_entity, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::write_entity>(callback, post, priority);
     }
 
     /**
      * @brief Registers a console variable.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarRegister(const std::add_pointer_t<void(cssdk::CVar* cvar)> callback, const bool post)
+    inline void HookCvarRegister(const std::add_pointer_t<void(cssdk::CVar* cvar)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_register, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_register>(callback, post, priority);
     }
 
     /**
      * @brief Gets the value of console variable as a float.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarGetFloat(const std::add_pointer_t<float(const char* cvar_name)> callback, const bool post)
+    inline void HookCvarGetFloat(const std::add_pointer_t<float(const char* cvar_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_get_float, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_get_float>(callback, post, priority);
     }
 
     /**
      * @brief Gets the value of console variable as a string.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarGetString(const std::add_pointer_t<const char*(const char* cvar_name)> callback, const bool post)
+    inline void HookCvarGetString(const std::add_pointer_t<const char*(const char* cvar_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_get_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_get_string>(callback, post, priority);
     }
 
     /**
      * @brief Sets the value of console variable as a float.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarSetFloat(const std::add_pointer_t<void(const char* cvar_name, float value)> callback, const bool post)
+    inline void HookCvarSetFloat(const std::add_pointer_t<void(const char* cvar_name, float value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_set_float, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_set_float>(callback, post, priority);
     }
 
     /**
      * @brief Sets the value of console variable as a string.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarSetString(const std::add_pointer_t<void(const char* cvar_name, const char* value)> callback, const bool post)
+    inline void HookCvarSetString(const std::add_pointer_t<void(const char* cvar_name, const char* value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_set_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_set_string>(callback, post, priority);
     }
 
     /**
      * @brief Outputs a message to the server console.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     template <typename... TArgs>
     void HookAlertMessage(const std::add_pointer_t<void(cssdk::AlertType type, const char* format, TArgs&&... args)> callback,
-                          const bool post)
+                          const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::alert_message, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::alert_message>(callback, post, priority);
     }
 
     /**
      * @brief Obsolete. Will print a message to the server console using alert_message indicating if it's being used.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     template <typename... TArgs>
     void HookEngineFilePrint(const std::add_pointer_t<void(void* file, const char* format, TArgs&&... args)> callback,
-                             const bool post)
+                             const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::engine_file_print, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::engine_file_print>(callback, post, priority);
     }
 
     /**
      * @brief Allocates memory for \c EntityBase instances.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookAllocEntPrivateData(const std::add_pointer_t<void*(cssdk::Edict* entity, cssdk::int32 size)> callback,
-                                        const bool post)
+                                        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::alloc_ent_private_data, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::alloc_ent_private_data>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookEntPrivateData(const std::add_pointer_t<void*(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookEntPrivateData(const std::add_pointer_t<void*(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::ent_private_data, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::ent_private_data>(callback, post, priority);
     }
 
     /**
      * @brief Frees the \c EntityBase memory assigned to entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookFreeEntPrivateData(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookFreeEntPrivateData(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::free_ent_private_data, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::free_ent_private_data>(callback, post, priority);
     }
 
     /**
      * @brief Gets the string assigned to the index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSzFromIndex(const std::add_pointer_t<const char*(unsigned int string)> callback, const bool post)
+    inline void HookSzFromIndex(const std::add_pointer_t<const char*(unsigned int string)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::sz_from_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::sz_from_index>(callback, post, priority);
     }
 
     /**
      * @brief Allocates a string in the string pool.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookAllocString(const std::add_pointer_t<unsigned int(const char* value)> callback, const bool post)
+    inline void HookAllocString(const std::add_pointer_t<unsigned int(const char* value)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::alloc_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::alloc_string>(callback, post, priority);
     }
 
     /**
      * @brief Gets the \c cssdk::EntityVars instance assigned to the given entity instance.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetVarsOfEnt(const std::add_pointer_t<cssdk::EntityVars*(cssdk::Edict* entity)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_vars_of_ent, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_vars_of_ent>(callback, post, priority);
     }
 
     /**
      * @brief Gets an entity by offset.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEntityOfEntOffset(const std::add_pointer_t<cssdk::Edict*(cssdk::eoffset entity_offset)> callback,
-                                      const bool post)
+                                      const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::entity_of_ent_offset, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::entity_of_ent_offset>(callback, post, priority);
     }
 
     /**
      * @brief Gets the entity offset of the entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEntOffsetOfEntity(const std::add_pointer_t<cssdk::eoffset(const cssdk::Edict* entity)> callback,
-                                      const bool post)
+                                      const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::ent_offset_of_entity, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::ent_offset_of_entity>(callback, post, priority);
     }
 
     /**
      * @brief Gets the entity index of the entity dictionary.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookIndexOfEdict(const std::add_pointer_t<int(const cssdk::Edict* edict)> callback, const bool post)
+    inline void HookIndexOfEdict(const std::add_pointer_t<int(const cssdk::Edict* edict)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::index_of_edict, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::index_of_edict>(callback, post, priority);
     }
 
     /**
      * @brief Gets the entity at the given entity index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEntityOfEntIndex(const std::add_pointer_t<cssdk::Edict*(int entity_index)> callback,
-                                     const bool post)
+                                     const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::entity_of_ent_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::entity_of_ent_index>(callback, post, priority);
     }
 
     /**
      * @brief Gets the entity of an \c cssdk::EntityVars.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookFindEntityByVars(const std::add_pointer_t<cssdk::Edict*(cssdk::EntityVars* vars)> callback,
-                                     const bool post)
+                                     const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::find_entity_by_vars, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::find_entity_by_vars>(callback, post, priority);
     }
 
     /**
      * @brief Gets the model pointer of the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetModelPointer(const std::add_pointer_t<void*(cssdk::Edict* entity)> callback, const bool post)
+    inline void HookGetModelPointer(const std::add_pointer_t<void*(cssdk::Edict* entity)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_model_pointer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_model_pointer>(callback, post, priority);
     }
 
     /**
      * @brief Registers a user message.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookRegUserMessage(const std::add_pointer_t<int(const char* name, int size)> callback, const bool post)
+    inline void HookRegUserMessage(const std::add_pointer_t<int(const char* name, int size)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::reg_user_message, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::reg_user_message>(callback, post, priority);
     }
 
     /**
      * @brief Does nothing.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookAnimationAutoMove(const std::add_pointer_t<void(const cssdk::Edict* entity, float time)> callback,
-                                      const bool post)
+                                      const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::animation_auto_move, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::animation_auto_move>(callback, post, priority);
     }
 
     /**
      * @brief Gets the bone position and angles for the given entity and bone.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetBonePosition(const std::add_pointer_t<void(const cssdk::Edict* entity, int bone, cssdk::Vector& origin, cssdk::Vector& angles)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_bone_position, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_bone_position>(callback, post, priority);
     }
 
     /**
      * @brief Gets the index of an exported function.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookFunctionFromName(const std::add_pointer_t<cssdk::uint32(const char* name)> callback, const bool post)
+    inline void HookFunctionFromName(const std::add_pointer_t<cssdk::uint32(const char* name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::function_from_name, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::function_from_name>(callback, post, priority);
     }
 
     /**
      * @brief Gets the name of an exported function.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookNameForFunction(const std::add_pointer_t<const char*(cssdk::uint32 function)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::name_for_function, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::name_for_function>(callback, post, priority);
     }
 
     /**
      * @brief Sends a message to the client console.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookClientPrint(const std::add_pointer_t<void(cssdk::Edict* entity, cssdk::PrintType type, const char* message)> callback,
-                                const bool post)
+                                const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::client_print, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::client_print>(callback, post, priority);
     }
 
     /**
      * @brief Sends a message to the server console.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookServerPrint(const std::add_pointer_t<void(const char* message)> callback, const bool post)
+    inline void HookServerPrint(const std::add_pointer_t<void(const char* message)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::server_print, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::server_print>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCmdArgs(const std::add_pointer_t<const char*()> callback, const bool post)
+    inline void HookCmdArgs(const std::add_pointer_t<const char*()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cmd_args, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cmd_args>(callback, post, priority);
     }
 
     /**
      * @brief Gets the command argument at the given index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCmdArgv(const std::add_pointer_t<const char*(int argc)> callback, const bool post)
+    inline void HookCmdArgv(const std::add_pointer_t<const char*(int argc)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cmd_argv, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cmd_argv>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCmdArgc(const std::add_pointer_t<int()> callback, const bool post)
+    inline void HookCmdArgc(const std::add_pointer_t<int()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cmd_argc, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cmd_argc>(callback, post, priority);
     }
 
     /**
      * @brief Gets the attachment origin and angles.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetAttachment(const std::add_pointer_t<void(const cssdk::Edict* entity, int attachment, cssdk::Vector& origin, cssdk::Vector& angles)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_attachment, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_attachment>(callback, post, priority);
     }
 
     /**
      * @brief Initializes the CRC instance.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCrc32Init(const std::add_pointer_t<void(cssdk::crc32* pul_crc)> callback, const bool post)
+    inline void HookCrc32Init(const std::add_pointer_t<void(cssdk::crc32* pul_crc)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::crc32_init, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::crc32_init>(callback, post, priority);
     }
 
     /**
      * @brief Processes a buffer and updates the CRC.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCrc32ProcessBuffer(const std::add_pointer_t<void(cssdk::crc32* pul_crc, void* buffer, int len)> callback,
-                                       const bool post)
+                                       const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::crc32_process_buffer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::crc32_process_buffer>(callback, post, priority);
     }
 
     /**
      * @brief Processes a single cssdk::byte.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCrc32ProcessByte(const std::add_pointer_t<void(cssdk::crc32* pul_crc, unsigned char ch)> callback,
-                                     const bool post)
+                                     const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::crc32_process_byte, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::crc32_process_byte>(callback, post, priority);
     }
 
     /**
      * @brief Finalizes the CRC instance.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCrc32Final(const std::add_pointer_t<cssdk::crc32(cssdk::crc32 pul_crc)> callback, const bool post)
+    inline void HookCrc32Final(const std::add_pointer_t<cssdk::crc32(cssdk::crc32 pul_crc)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::crc32_final, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::crc32_final>(callback, post, priority);
     }
 
     /**
      * @brief Generates a random long number in the range [low, high].
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookRandomLong(const std::add_pointer_t<cssdk::int32(cssdk::int32 low, cssdk::int32 high)> callback,
-                               const bool post)
+                               const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::random_long, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::random_long>(callback, post, priority);
     }
 
     /**
      * @brief Generates a random float number in the range [low, high].
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookRandomFloat(const std::add_pointer_t<float(float low, float high)> callback, const bool post)
+    inline void HookRandomFloat(const std::add_pointer_t<float(float low, float high)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::random_float, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::random_float>(callback, post, priority);
     }
 
     /**
      * @brief Sets the view of a client to the given entity.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetView(const std::add_pointer_t<void(const cssdk::Edict* client, const cssdk::Edict* view_entity)> callback,
-                            const bool post)
+                            const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_view, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_view>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookTime(const std::add_pointer_t<float()> callback, const bool post)
+    inline void HookTime(const std::add_pointer_t<float()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::time, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::time>(callback, post, priority);
     }
 
     /**
      * @brief Sets the angles of the given client's crosshairs to the given settings.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCrosshairAngle(const std::add_pointer_t<void(const cssdk::Edict* client, float pitch, float yaw)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::crosshair_angle, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::crosshair_angle>(callback, post, priority);
     }
 
     /**
      * @brief Loads a file from disk.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookLoadFileForMe(const std::add_pointer_t<cssdk::byte*(const char* file_name, int* length)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::load_file_for_me, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::load_file_for_me>(callback, post, priority);
     }
 
     /**
      * @brief Frees the buffer provided by the \c LoadFileForMe.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookFreeFile(const std::add_pointer_t<void(void* buffer)> callback, const bool post)
+    inline void HookFreeFile(const std::add_pointer_t<void(void* buffer)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::free_file, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::free_file>(callback, post, priority);
     }
 
     /**
      * @brief Signals the engine that a section has ended.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookEndSection(const std::add_pointer_t<void(const char* section_name)> callback, const bool post)
+    inline void HookEndSection(const std::add_pointer_t<void(const char* section_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::end_section, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::end_section>(callback, post, priority);
     }
 
     /**
      * @brief Compares file times.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCompareFileTime(const std::add_pointer_t<cssdk::qboolean(char* file_name1, char* file_name2, int* compare)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::compare_file_time, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::compare_file_time>(callback, post, priority);
     }
 
     /**
      * @brief Gets the game directory name.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetGameDir(const std::add_pointer_t<void(char* game_dir)> callback, const bool post)
+    inline void HookGetGameDir(const std::add_pointer_t<void(char* game_dir)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_game_dir, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_game_dir>(callback, post, priority);
     }
 
     /**
      * @brief Registers a Cvar. Identical to \c CvarRegister, except it doesn't set the \c FCVAR_EXT_DLL flag.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCvarRegisterVariable(const std::add_pointer_t<void(cssdk::CVar* variable)> callback, const bool post)
+    inline void HookCvarRegisterVariable(const std::add_pointer_t<void(cssdk::CVar* variable)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_register_variable, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_register_variable>(callback, post, priority);
     }
 
     /**
      * @brief Fades the given client's volume.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookFadeClientVolume(
         const std::add_pointer_t<void(const cssdk::Edict* client, int fade_percent, int fade_out_seconds, int hold_time, int fade_in_seconds)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::fade_client_volume, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::fade_client_volume>(callback, post, priority);
     }
 
     /**
      * @brief Sets the client's maximum speed value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetClientMaxSpeed(const std::add_pointer_t<void(cssdk::Edict* client, float new_max_speed)> callback,
-                                      const bool post)
+                                      const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_client_max_speed, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_client_max_speed>(callback, post, priority);
     }
 
     /**
      * @brief Creates a fake client (bot).
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookCreateFakeClient(const std::add_pointer_t<cssdk::Edict*(const char* name)> callback, const bool post)
+    inline void HookCreateFakeClient(const std::add_pointer_t<cssdk::Edict*(const char* name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::create_fake_client, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::create_fake_client>(callback, post, priority);
     }
 
     /**
      * @brief Runs client movement for a fake client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookRunPlayerMove(
         const std::add_pointer_t<void(cssdk::Edict* fake_client, const cssdk::Vector& view_angles, float forward_move, float side_move, float up_move, unsigned short buttons, cssdk::byte impulse, cssdk::byte msec)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::run_player_move, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::run_player_move>(callback, post, priority);
     }
 
     /**
      * @brief Computes the total number of entities currently in existence.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookNumberOfEntities(const std::add_pointer_t<int()> callback, const bool post)
+    inline void HookNumberOfEntities(const std::add_pointer_t<int()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::number_of_entities, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::number_of_entities>(callback, post, priority);
     }
 
     /**
      * @brief Gets the given client's info key buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetInfoKeyBuffer(const std::add_pointer_t<char*(cssdk::Edict* client)> callback, const bool post)
+    inline void HookGetInfoKeyBuffer(const std::add_pointer_t<char*(cssdk::Edict* client)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_info_key_buffer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_info_key_buffer>(callback, post, priority);
     }
 
     /**
      * @brief Gets the value of the given key from the given buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookInfoKeyValue(const std::add_pointer_t<char*(char* info_buffer, const char* key)> callback,
-                                 const bool post)
+                                 const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::info_key_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::info_key_value>(callback, post, priority);
     }
 
     /**
      * @brief Sets the value of the given key in the given buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetKeyValue(const std::add_pointer_t<void(char* info_buffer, const char* key, const char* value)> callback,
-                                const bool post)
+                                const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_key_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_key_value>(callback, post, priority);
     }
 
     /**
      * @brief Sets the value of the given key in the given buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetClientKeyValue(const std::add_pointer_t<void(int client_index, char* info_buffer, const char* key, const char* value)> callback,
-                                      const bool post)
+                                      const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_client_key_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_client_key_value>(callback, post, priority);
     }
 
     /**
      * @brief Checks if the given file_name is a valid map.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookIsMapValid(const std::add_pointer_t<cssdk::qboolean(const char* file_name)> callback, const bool post)
+    inline void HookIsMapValid(const std::add_pointer_t<cssdk::qboolean(const char* file_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::is_map_valid, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::is_map_valid>(callback, post, priority);
     }
 
     /**
      * @brief Projects a inline decal in the world.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookStaticDecal(const std::add_pointer_t<void(const cssdk::Vector& origin, int decal_index, int entity_index, int model_index)> callback,
-                                const bool post)
+                                const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::static_decal, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::static_decal>(callback, post, priority);
     }
 
     /**
      * @brief Precaches a file.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookPrecacheGeneric(const std::add_pointer_t<int(const char* path)> callback, const bool post)
+    inline void HookPrecacheGeneric(const std::add_pointer_t<int(const char* path)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::precache_generic, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::precache_generic>(callback, post, priority);
     }
 
     /**
      * @brief Returns the server assigned user id for this client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetPlayerUserId(const std::add_pointer_t<int(cssdk::Edict* client)> callback, const bool post)
+    inline void HookGetPlayerUserId(const std::add_pointer_t<int(cssdk::Edict* client)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_player_user_id, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_player_user_id>(callback, post, priority);
     }
 
     /**
      * @brief Builds a sound message to send to a client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookBuildSoundMsg(const std::add_pointer_t<void(cssdk::Edict* entity, int channel, const char* sample, float volume, float attenuation, int flags, int pitch, cssdk::MessageType msg_type, int msg_id, const cssdk::Vector& origin, cssdk::Edict* client)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
 
     {
-        detail::SetHook(&cssdk::EngineFunctions::build_sound_msg, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::build_sound_msg>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookIsDedicatedServer(const std::add_pointer_t<cssdk::qboolean()> callback, const bool post)
+    inline void HookIsDedicatedServer(const std::add_pointer_t<cssdk::qboolean()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::is_dedicated_server, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::is_dedicated_server>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCvarGetPointer(const std::add_pointer_t<cssdk::CVar*(const char* cvar_name)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_get_pointer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_get_pointer>(callback, post, priority);
     }
 
     /**
      * @brief Returns the server assigned WON id for this client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetPlayerWonId(const std::add_pointer_t<unsigned int(cssdk::Edict* client)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_player_won_id, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_player_won_id>(callback, post, priority);
     }
 
     /**
      * @brief Removes a key from the info buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookInfoRemoveKey(const std::add_pointer_t<void(char* info_buffer, const char* key)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::info_remove_key, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::info_remove_key>(callback, post, priority);
     }
 
     /**
      * @brief Gets the given physics key-value from the given client's buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetPhysicsKeyValue(const std::add_pointer_t<const char*(const cssdk::Edict* client, const char* key)> callback,
-                                       const bool post)
+                                       const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_physics_key_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_physics_key_value>(callback, post, priority);
     }
 
     /**
      * @brief Sets the given physics key-value in the given client's buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSetPhysicsKeyValue(const std::add_pointer_t<void(const cssdk::Edict* client, const char* key, const char* value)> callback,
-                                       const bool post)
+                                       const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_physics_key_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_physics_key_value>(callback, post, priority);
     }
 
     /**
      * @brief Gets the physics info string for the given client.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetPhysicsInfoString(const std::add_pointer_t<const char*(const cssdk::Edict* client)> callback,
-                                         const bool post)
+                                         const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_physics_info_string, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_physics_info_string>(callback, post, priority);
     }
 
     /**
      * @brief Precaches an event.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookPrecacheEvent(const std::add_pointer_t<unsigned short(int type, const char* path)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::precache_event, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::precache_event>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookPlaybackEvent(
         const std::add_pointer_t<void(int flags, const cssdk::Edict* invoker, unsigned short event_index, float delay, cssdk::Vector& origin, cssdk::Vector& angles, float f_param1, float f_param2, int i_param1, int i_param2, cssdk::qboolean b_param1, cssdk::qboolean b_param2)> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::playback_event, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::playback_event>(callback, post, priority);
     }
 
     /**
      * @brief Sets the fat potentially visible set buffer to contain data based on the given origin.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSetFatPvs(const std::add_pointer_t<unsigned char*(cssdk::Vector& origin)> callback, const bool post)
+    inline void HookSetFatPvs(const std::add_pointer_t<unsigned char*(cssdk::Vector& origin)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_fat_pvs, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_fat_pvs>(callback, post, priority);
     }
 
     /**
      * @brief Sets the fat potentially audible set buffer to contain data based on the given origin.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSetFatPas(const std::add_pointer_t<unsigned char*(cssdk::Vector& origin)> callback, const bool post)
+    inline void HookSetFatPas(const std::add_pointer_t<unsigned char*(cssdk::Vector& origin)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_fat_pas, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_fat_pas>(callback, post, priority);
     }
 
     /**
      * @brief Checks if the given entity is visible in the given visible set.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCheckVisibility(const std::add_pointer_t<cssdk::qboolean(cssdk::Edict* entity, unsigned char* set)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::check_visibility, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::check_visibility>(callback, post, priority);
     }
 
     /**
      * @brief Marks the given field in the given list as set.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaSetField(const std::add_pointer_t<void(void* fields, const char* field_name)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_set_field, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_set_field>(callback, post, priority);
     }
 
     /**
      * @brief Marks the given field in the given list as not set.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaUnsetField(const std::add_pointer_t<void(void* fields, const char* field_name)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_unset_field, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_unset_field>(callback, post, priority);
     }
 
     /**
      * @brief Adds a delta encoder.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaAddEncoder(
         const std::add_pointer_t<void(const char* name, void (*conditional_encode)(void* fields, const unsigned char* from, const unsigned char* to))> callback,
-        const bool post)
+        const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_add_encoder, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_add_encoder>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetCurrentPlayer(const std::add_pointer_t<int()> callback, const bool post)
+    inline void HookGetCurrentPlayer(const std::add_pointer_t<int()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_current_player, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_current_player>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCanSkipPlayer(const std::add_pointer_t<cssdk::qboolean(const cssdk::Edict* client)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::can_skip_player, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::can_skip_player>(callback, post, priority);
     }
 
     /**
      * @brief Finds the index of a delta field.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaFindField(const std::add_pointer_t<int(void* fields, const char* field_name)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_find_field, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_find_field>(callback, post, priority);
     }
 
     /**
      * @brief Marks a delta field as set by index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaSetFieldByIndex(const std::add_pointer_t<void(void* fields, int field_number)> callback,
-                                         const bool post)
+                                         const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_set_field_by_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_set_field_by_index>(callback, post, priority);
     }
 
     /**
      * @brief Marks a delta field as not set by index.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookDeltaUnsetFieldByIndex(const std::add_pointer_t<void(void* fields, int field_number)> callback,
-                                           const bool post)
+                                           const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::delta_unset_field_by_index, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::delta_unset_field_by_index>(callback, post, priority);
     }
 
     /**
      * @brief Used to filter contents checks.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookSetGroupMask(const std::add_pointer_t<void(int mask, int operation)> callback, const bool post)
+    inline void HookSetGroupMask(const std::add_pointer_t<void(int mask, int operation)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::set_group_mask, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::set_group_mask>(callback, post, priority);
     }
 
     /**
      * @brief Creates an instanced baseline. Used to define a baseline for a particular entity type.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCreateInstancedBaseline(const std::add_pointer_t<int(cssdk::Strind class_name, cssdk::EntityState* baseline)> callback,
-                                            const bool post)
+                                            const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::create_instanced_baseline, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::create_instanced_baseline>(callback, post, priority);
     }
 
     /**
      * @brief Directly sets a console variable value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookCvarDirectSet(const std::add_pointer_t<void(cssdk::CVar* cvar, const char* value)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::cvar_direct_set, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::cvar_direct_set>(callback, post, priority);
     }
 
     /**
      * @brief Forces the client and server to be running with the same version of the specified file (e.g., a client model).
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookForceUnmodified(const std::add_pointer_t<void(cssdk::ForceType type, cssdk::Vector& min_size, cssdk::Vector& max_size, const char* file_name)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::force_unmodified, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::force_unmodified>(callback, post, priority);
     }
 
     /**
      * @brief Get client statistics.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetPlayerStats(const std::add_pointer_t<void(const cssdk::Edict* client, int* ping, int* packet_loss)> callback,
-                                   const bool post)
+                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_player_stats, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_player_stats>(callback, post, priority);
     }
 
     /**
      * @brief Adds a server command.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookAddServerCommand(const std::add_pointer_t<void(const char* cmd_name, void (*callback)())> callback,
-                                     const bool post)
+                                     const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::add_server_command, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::add_server_command>(callback, post, priority);
     }
 
     /**
      * @brief Gets whether the given receiver can hear the given sender.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookVoiceGetClientListening(const std::add_pointer_t<cssdk::qboolean(int receiver, int sender)> callback,
-                                            const bool post)
+                                            const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::voice_get_client_listening, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::voice_get_client_listening>(callback, post, priority);
     }
 
     /**
      * @brief Sets whether the given receiver can hear the given sender.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookVoiceSetClientListening(const std::add_pointer_t<cssdk::qboolean(int receiver, int sender, cssdk::qboolean listen)> callback,
-                                            const bool post)
+                                            const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::voice_set_client_listening, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::voice_set_client_listening>(callback, post, priority);
     }
 
     /**
      * @brief Gets the client's auth ID.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetPlayerAuthId(const std::add_pointer_t<const char*(cssdk::Edict* client)> callback,
-                                    const bool post)
+                                    const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_player_auth_id, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_player_auth_id>(callback, post, priority);
     }
 
     /**
      * @brief Gets the sequence that has the given entry name.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSequenceGet(const std::add_pointer_t<cssdk::SequenceEntry*(const char* file_name, const char* entry_name)> callback,
-                                const bool post)
+                                const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::sequence_get, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::sequence_get>(callback, post, priority);
     }
 
     /**
      * @brief Picks a sentence from the given group.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookSequencePickSentence(const std::add_pointer_t<cssdk::SentenceEntry*(const char* group_name, int pick_method, int* picked)> callback,
-                                         const bool post)
+                                         const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::sequence_pick_sentence, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::sequence_pick_sentence>(callback, post, priority);
     }
 
     /**
      * @brief LH: Give access to file size via filesystem.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetFileSize(const std::add_pointer_t<int(const char* file_name)> callback, const bool post)
+    inline void HookGetFileSize(const std::add_pointer_t<int(const char* file_name)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_file_size, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_file_size>(callback, post, priority);
     }
 
     /**
      * @brief Gets the average wave length in seconds.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetApproxWavePlayLen(const std::add_pointer_t<unsigned int(const char* file_path)> callback,
-                                         const bool post)
+                                         const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_approx_wave_play_len, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_approx_wave_play_len>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookIsCareerMatch(const std::add_pointer_t<cssdk::qboolean()> callback, const bool post)
+    inline void HookIsCareerMatch(const std::add_pointer_t<cssdk::qboolean()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::is_career_match, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::is_career_match>(callback, post, priority);
     }
 
     /**
      * @brief N/D
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookGetLocalizedStringLength(const std::add_pointer_t<int(const char* label)> callback,
-                                             const bool post)
+                                             const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_localized_string_length, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_localized_string_length>(callback, post, priority);
     }
 
     /**
      * @brief Marks the message with the given ID as having been shown.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookRegisterTutorMessageShown(const std::add_pointer_t<void(int message_id)> callback, const bool post)
+    inline void HookRegisterTutorMessageShown(const std::add_pointer_t<void(int message_id)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::register_tutor_message_shown, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::register_tutor_message_shown>(callback, post, priority);
     }
 
     /**
      * @brief Gets the number of times the message with the given ID has been shown.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookGetTimesTutorMessageShown(const std::add_pointer_t<int(int message_id)> callback, const bool post)
+    inline void HookGetTimesTutorMessageShown(const std::add_pointer_t<int(int message_id)> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::get_times_tutor_message_shown, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::get_times_tutor_message_shown>(callback, post, priority);
     }
 
     /**
      * @brief Processes the tutor message decay buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookProcessTutorMessageDecayBuffer(const std::add_pointer_t<void(int* buffer, int buffer_length)> callback,
-                                                   const bool post)
+                                                   const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::process_tutor_message_decay_buffer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::process_tutor_message_decay_buffer>(callback, post, priority);
     }
 
     /**
      * @brief Constructs the tutor message decay buffer.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookConstructTutorMessageDecayBuffer(const std::add_pointer_t<void(int* buffer, int buffer_length)> callback,
-                                                     const bool post)
+                                                     const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::construct_tutor_message_decay_buffer, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::construct_tutor_message_decay_buffer>(callback, post, priority);
     }
 
     /**
      * @brief Resets tutor message decay data.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
-    inline void HookResetTutorMessageDecayData(const std::add_pointer_t<void()> callback, const bool post)
+    inline void HookResetTutorMessageDecayData(const std::add_pointer_t<void()> callback, const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::reset_tutor_message_decay_data, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::reset_tutor_message_decay_data>(callback, post, priority);
     }
 
     /**
      * @brief Queries the given client for a cvar value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookQueryClientCvarValue(const std::add_pointer_t<void(const cssdk::Edict* client, const char* cvar_name)> callback,
-                                         const bool post)
+                                         const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::query_client_cvar_value, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::query_client_cvar_value>(callback, post, priority);
     }
 
     /**
      * @brief Queries the given client for a cvar value.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookQueryClientCvarValue2(const std::add_pointer_t<void(const cssdk::Edict* client, const char* cvar_name, int request_id)> callback,
-                                          const bool post)
+                                          const bool post, const int priority = 0)
     {
-        detail::SetHook(&cssdk::EngineFunctions::query_client_cvar_value2, callback, post);
+        detail::SetHook<&cssdk::EngineFunctions::query_client_cvar_value2>(callback, post, priority);
     }
 
     /**
      * @brief Checks if a command line parameter was provided.
      *
-     * @param callback The callback function pointer or \c nullptr to disable this hook.
+     * @param callback The callback function pointer to add or \c nullptr to disable this hook.
      * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
     */
     inline void HookEngCheckParam(const std::add_pointer_t<int(const char* cmd_line_token, char** next)> callback,
-                                  const bool post)
+                                  const bool post, const int priority = 0)
+    {
+        detail::SetHook<&cssdk::EngineFunctions::eng_check_param>(callback, post, priority);
+    }
+
+    /**
+     * @brief Replaces all engine hooks with a table built at compile time.
+     * Callbacks added afterwards with the \c Hook* functions are chained with the ones of the table.
+     * The hooks installed by the SDK facilities are kept.
+     *
+     * @tparam THookTable \c metamod::HookTable of \c cssdk::EngineFunctions hooks.
+     * @param post Is this a post hook table?
+    */
+    template <typename THookTable>
+    void SetHookTable(const bool post)
     {
-        detail::SetHook(&cssdk::EngineFunctions::eng_check_param, callback, post);
+        static_assert(std::is_same_v<typename THookTable::Table, cssdk::EngineFunctions>, "Not an engine hook table.");
+        detail::SetHookTable(THookTable::TABLE, post);
     }
 }
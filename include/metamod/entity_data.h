@@ -0,0 +1,187 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <metamod/engine.h>
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace metamod::engine::detail
+{
+    /**
+     * @brief Per-entity storage whose values are destroyed with their entities.
+    */
+    class EntityStorage
+    {
+    public:
+        EntityStorage(const EntityStorage&) = delete;
+        EntityStorage& operator=(const EntityStorage&) = delete;
+
+        /**
+         * @brief Destroys the value of the entity with the given index.
+        */
+        virtual void Destroy(std::size_t index) = 0;
+
+        /**
+         * @brief Destroys the values of all entities.
+        */
+        virtual void DestroyAll() = 0;
+
+        /**
+         * @brief Next storage in the list of the storages holding values.
+        */
+        EntityStorage* next{};
+
+    protected:
+        EntityStorage() = default;
+
+        virtual ~EntityStorage()
+        {
+            Unlink();
+        }
+
+        /**
+         * @brief Adds the storage to the list of the storages destroyed by the hooks, installing the hooks if needed.
+        */
+        void Link();
+
+        void Unlink();
+
+    private:
+        bool linked_{};
+    };
+
+    /**
+     * @brief Head of the list of the storages holding values.
+    */
+    inline EntityStorage* entity_storages{};
+}
+
+namespace metamod::engine
+{
+    /**
+     * @brief Plugin data attached to entities, stored in a dense array indexed by \c IndexOfEdict.
+     *
+     * A value is constructed on the first \c Get for its entity and destroyed by the \c FreeEntityPrivateData
+     * post hook when the entity is freed, and for all entities on \c ServerDeactivate. It replaces
+     * <tt>std::unordered_map<cssdk::Edict*, T></tt>: an access is an array index instead of a hash lookup,
+     * and the values of the freed entities do not leak.
+     *
+     * @code
+     * struct BurnState
+     * {
+     *     float end_time{};
+     *     metamod::engine::EntityHandle attacker{};
+     * };
+     *
+     * metamod::engine::EntityData<BurnState> burn_states{};
+     *
+     * if (auto* const state = burn_states.Get(victim); state != nullptr) {
+     *     state->end_time = metamod::engine::Time() + 5.F;
+     * }
+     * @endcode
+    */
+    template <typename T>
+    class EntityData final : public detail::EntityStorage
+    {
+    public:
+        EntityData() = default;
+
+        /**
+         * @brief Returns the value of the entity, constructing it if needed.
+         * The pointer is valid until the value is destroyed.
+         *
+         * @return The value, or \c nullptr if \c index is negative.
+        */
+        T* Get(const int index)
+        {
+            if (index < 0) {
+                return nullptr;
+            }
+
+            if (static_cast<std::size_t>(index) >= slots_.size()) {
+                // Sized for every entity at once, so the values are not moved by later accesses.
+                slots_.resize(std::max(static_cast<std::size_t>(index) + 1,
+                                       static_cast<std::size_t>(cssdk::g_global_vars->max_entities)));
+            }
+
+            auto& slot = slots_[index];
+
+            if (!slot.has_value()) {
+                Link();
+                slot.emplace();
+            }
+
+            return &*slot;
+        }
+
+        /**
+         * @brief Returns the value of the entity, constructing it if needed.
+         *
+         * @return The value, or \c nullptr if \c entity is \c nullptr.
+        */
+        T* Get(const cssdk::Edict* const entity)
+        {
+            return entity != nullptr ? Get(IndexOfEdict(entity)) : nullptr;
+        }
+
+        /**
+         * @brief Returns the value of the entity, or \c nullptr if it has none.
+        */
+        [[nodiscard]] FORCEINLINE T* Find(const int index)
+        {
+            if (index < 0 || static_cast<std::size_t>(index) >= slots_.size() || !slots_[index].has_value()) {
+                return nullptr;
+            }
+
+            return &*slots_[index];
+        }
+
+        /**
+         * @brief Returns the value of the entity, or \c nullptr if it has none.
+        */
+        [[nodiscard]] FORCEINLINE T* Find(const cssdk::Edict* const entity)
+        {
+            return entity != nullptr ? Find(IndexOfEdict(entity)) : nullptr;
+        }
+
+        /**
+         * @brief Destroys the value of the entity with the given index.
+        */
+        void Destroy(const std::size_t index) override
+        {
+            if (index < slots_.size()) {
+                slots_[index].reset();
+            }
+        }
+
+        void DestroyAll() override
+        {
+            for (auto& slot : slots_) {
+                slot.reset();
+            }
+        }
+
+    private:
+        std::vector<std::optional<T>> slots_{};
+    };
+}
@@ -0,0 +1,322 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_chain.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Selects the entities a filtered hook is called for.
+     * An entity is accepted if its class name or its index is listed.
+    */
+    struct EntityFilter
+    {
+        /**
+         * @brief Class names of the accepted entities.
+        */
+        std::vector<std::string> class_names{};
+
+        /**
+         * @brief Indices of the accepted entities.
+        */
+        std::vector<int> indices{};
+    };
+}
+
+namespace metamod::gamedll::detail
+{
+    /**
+     * @brief Filter state of an entity slot.
+    */
+    struct FilteredEntity
+    {
+        /**
+         * @brief Bit \c N is set if the entity is accepted by the filter with id \c N.
+        */
+        std::uint64_t filters{};
+
+        /**
+         * @brief Whether \c filters is up to date for the entity that currently occupies the slot.
+        */
+        bool classified{};
+    };
+
+    /**
+     * @brief Maximum number of distinct entity filters.
+    */
+    constexpr std::size_t MAX_ENTITY_FILTERS = 64;
+
+    /**
+     * @brief Registered filter.
+    */
+    struct RegisteredEntityFilter
+    {
+        gamedll::EntityFilter filter{};
+
+        /**
+         * @brief Number of filtered callbacks using the filter; the id of an unused filter is reused.
+        */
+        std::size_t uses{};
+    };
+
+    /**
+     * @brief Registered filters; the position of a filter is its id.
+    */
+    inline std::vector<RegisteredEntityFilter> entity_filters{};
+
+    /**
+     * @brief Filter state of the entities, indexed by \c IndexOfEdict.
+    */
+    inline std::vector<FilteredEntity> filtered_entities{};
+
+    /**
+     * @brief Returns the id of the given filter, registering it if needed, and adds a use of it.
+     *
+     * @return Filter id, or \c MAX_ENTITY_FILTERS if there are too many filters.
+    */
+    std::size_t RegisterEntityFilter(const gamedll::EntityFilter& filter);
+
+    /**
+     * @brief Removes a use of the filter added by \c RegisterEntityFilter.
+    */
+    void ReleaseEntityFilter(std::size_t id);
+
+    /**
+     * @brief Matches the entity against all filters and caches the result.
+    */
+    std::uint64_t ClassifyEntity(const cssdk::Edict* entity, int index);
+
+    /**
+     * @brief Returns the mask of the filters accepting the given entity.
+    */
+    FORCEINLINE std::uint64_t EntityFilterMask(const cssdk::Edict* const entity)
+    {
+        const auto index = engine::IndexOfEdict(entity);
+
+        if (index >= 0 && static_cast<std::size_t>(index) < filtered_entities.size()) {
+            if (const auto& state = filtered_entities[index]; state.classified) {
+                return state.filters;
+            }
+        }
+
+        return ClassifyEntity(entity, index);
+    }
+
+    /**
+     * @brief Maximum number of filtered callbacks of a hook slot.
+    */
+    constexpr std::size_t MAX_FILTERED_CALLBACKS = 32;
+
+    /**
+     * @brief Filtered callbacks of a hook slot whose first parameter is the filtered entity.
+     *
+     * Every filtered callback is added to the slot's hook chain through a wrapper of its own that checks the filter,
+     * so it is ordered by its priority among the unfiltered callbacks of the slot.
+    */
+    template <auto Member, bool Post, typename TCallback = typename metamod::detail::HookSlot<decltype(Member)>::Callback>
+    struct FilteredHookChain;
+
+    template <auto Member, bool Post, typename... TArgs>
+    struct FilteredHookChain<Member, Post, void (*)(cssdk::Edict*, TArgs...)>
+    {
+        using Callback = void (*)(cssdk::Edict*, TArgs...);
+
+        struct Entry
+        {
+            Callback callback{};
+            std::size_t filter_id{};
+        };
+
+        static inline std::array<Entry, MAX_FILTERED_CALLBACKS> entries{};
+        static inline metamod::detail::HookChainNode<cssdk::DllFunctions> node{};
+
+        /**
+         * @brief Adds the callback, or removes all filtered callbacks if \c callback is \c nullptr.
+         * Adding a callback that is already added changes its filter and priority.
+         *
+         * @return \c false if the callback was not added because the slot has too many filtered callbacks.
+        */
+        static bool Set(const Callback callback, const std::size_t filter_id, const int priority)
+        {
+            if (callback == nullptr) {
+                for (std::size_t slot = 0; slot < entries.size(); ++slot) {
+                    if (entries[slot].callback != nullptr) {
+                        RemoveHook<Member>(Wrapper(slot), Post);
+                    }
+                }
+
+                Reset(nullptr, false);
+                return true;
+            }
+
+            auto slot = FindSlot(callback);
+
+            if (slot < entries.size()) {
+                ReleaseEntityFilter(entries[slot].filter_id);
+            }
+            else if (slot = FindSlot(nullptr); slot >= entries.size()) {
+                engine::AlertMessage(cssdk::AlertType::Logged, "Filtered hook: too many filtered callbacks; maximum = %d.\n",
+                             static_cast<int>(MAX_FILTERED_CALLBACKS));
+                return false;
+            }
+
+            metamod::detail::RegisterHookChain<cssdk::DllFunctions>(node, &Reset, Post);
+            entries[slot] = Entry{callback, filter_id};
+            SetHook<Member>(Wrapper(slot), Post, priority);
+
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Calls the callback in the given slot if its filter accepts the entity.
+        */
+        template <std::size_t Slot>
+        static void Dispatch(cssdk::Edict* const entity, TArgs... args)
+        {
+            const auto& entry = entries[Slot];
+
+            if (EntityFilterMask(entity) & std::uint64_t{1} << entry.filter_id) {
+                entry.callback(entity, args...);
+            }
+            else {
+                g_globals->result = Result::Ignored;
+            }
+        }
+
+        template <std::size_t... Slots>
+        static constexpr std::array<Callback, sizeof...(Slots)> MakeWrappers(std::index_sequence<Slots...>)
+        {
+            return {&Dispatch<Slots>...};
+        }
+
+        static Callback Wrapper(const std::size_t slot)
+        {
+            static constexpr auto wrappers = MakeWrappers(std::make_index_sequence<MAX_FILTERED_CALLBACKS>{});
+            return wrappers[slot];
+        }
+
+        static std::size_t FindSlot(const Callback callback)
+        {
+            const auto it = std::find_if(entries.cbegin(), entries.cend(), [callback](const Entry& entry) {
+                return entry.callback == callback;
+            });
+
+            return static_cast<std::size_t>(it - entries.cbegin());
+        }
+
+        /**
+         * @brief The wrappers are removed from the hook chain by its own reset.
+        */
+        static void Reset(cssdk::DllFunctions*, bool)
+        {
+            for (auto& entry : entries) {
+                if (entry.callback != nullptr) {
+                    ReleaseEntityFilter(entry.filter_id);
+                    entry = Entry{};
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Adds a filtered callback to the hook slot \c Member.
+    */
+    template <auto Member, typename TCallback>
+    void SetFilteredHook(const TCallback callback, const bool post, const gamedll::EntityFilter& filter, const int priority)
+    {
+        std::size_t id{};
+
+        if (callback != nullptr) {
+            id = RegisterEntityFilter(filter);
+
+            if (id >= MAX_ENTITY_FILTERS) {
+                return;
+            }
+        }
+
+        const auto added = post ? FilteredHookChain<Member, true>::Set(callback, id, priority)
+                                : FilteredHookChain<Member, false>::Set(callback, id, priority);
+
+        if (!added) {
+            ReleaseEntityFilter(id);
+        }
+    }
+}
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Called by the engine to run this entity's think function.
+     * The callback is called only for the entities accepted by \c filter.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all filtered callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param filter Entities the callback is called for.
+     * @param priority Callbacks of this hook with a higher priority are called first.
+    */
+    inline void HookThink(const std::add_pointer_t<void(cssdk::Edict* entity)> callback, const bool post,
+                          const EntityFilter& filter, const int priority = 0)
+    {
+        detail::SetFilteredHook<&cssdk::DllFunctions::think>(callback, post, filter, priority);
+    }
+
+    /**
+     * @brief Called by the engine to run \c entity_touched's \c touch function with \c entity_other as the other entity.
+     * The callback is called only if \c entity_touched is accepted by \c filter.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all filtered callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param filter Entities the callback is called for.
+     * @param priority Callbacks of this hook with a higher priority are called first.
+    */
+    inline void HookTouch(const std::add_pointer_t<void(cssdk::Edict* entity_touched, cssdk::Edict* entity_other)> callback,
+                          const bool post, const EntityFilter& filter, const int priority = 0)
+    {
+        detail::SetFilteredHook<&cssdk::DllFunctions::touch>(callback, post, filter, priority);
+    }
+
+    /**
+     * @brief Called by the engine to run \c entity_blocked's \c blocked function with \c entity_other as the other entity.
+     * The callback is called only if \c entity_blocked is accepted by \c filter.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all filtered callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param filter Entities the callback is called for.
+     * @param priority Callbacks of this hook with a higher priority are called first.
+    */
+    inline void HookBlocked(const std::add_pointer_t<void(cssdk::Edict* entity_blocked, cssdk::Edict* entity_other)> callback,
+                            const bool post, const EntityFilter& filter, const int priority = 0)
+    {
+        detail::SetFilteredHook<&cssdk::DllFunctions::blocked>(callback, post, filter, priority);
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace metamod::engine::detail
+{
+    /**
+     * @brief Entity slot referenced by handles.
+    */
+    struct HandleSlot
+    {
+        cssdk::Edict* entity{};
+
+        /**
+         * @brief Incremented when the entity is freed; never 0.
+        */
+        std::uint32_t generation{1};
+    };
+
+    /**
+     * @brief Slots by entity index.
+    */
+    inline std::vector<HandleSlot> handle_slots{};
+
+    /**
+     * @brief Records the entity in its slot and returns the slot's generation, or 0 if the entity is not valid.
+    */
+    std::uint32_t TrackEntity(cssdk::Edict* entity, int index);
+}
+
+namespace metamod::engine
+{
+    /**
+     * @brief 32-bit reference to an entity that becomes null when the entity is freed.
+     *
+     * A handle stores the entity index and the generation of the index. The generation is incremented by the
+     * \c FreeEntityPrivateData and \c RemoveEntity hooks and for all entities on \c ServerDeactivate, so
+     * resolving a handle is a compare against a dense generation array and does not call the engine.
+     *
+     * @code
+     * metamod::engine::EntityHandle target{entity};
+     * // A later frame:
+     * if (auto* const entity = target.Get(); entity != nullptr) { ... }
+     * @endcode
+    */
+    class EntityHandle
+    {
+    public:
+        static constexpr std::uint32_t INDEX_BITS = 12;
+        static constexpr std::uint32_t INDEX_MASK = (1U << INDEX_BITS) - 1;
+
+        /**
+         * @brief Generations wrap at this value.
+        */
+        static constexpr std::uint32_t MAX_GENERATION = (1U << (32 - INDEX_BITS)) - 1;
+
+        /**
+         * @brief Creates a null handle.
+        */
+        constexpr EntityHandle() = default;
+
+        /**
+         * @brief Creates a handle to the entity; a null handle if the entity is \c nullptr or free.
+        */
+        explicit EntityHandle(cssdk::Edict* entity);
+
+        /**
+         * @brief Restores a handle from \c Value.
+        */
+        static constexpr EntityHandle FromValue(const std::uint32_t value)
+        {
+            EntityHandle handle{};
+            handle.value_ = value;
+
+            return handle;
+        }
+
+        /**
+         * @brief Returns the entity, or \c nullptr if it was freed.
+        */
+        [[nodiscard]] FORCEINLINE cssdk::Edict* Get() const
+        {
+            const auto index = value_ & INDEX_MASK;
+
+            if (index < detail::handle_slots.size()) {
+                if (const auto& slot = detail::handle_slots[index]; slot.generation == value_ >> INDEX_BITS) {
+                    return slot.entity;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * @brief Whether the entity is still alive.
+        */
+        [[nodiscard]] FORCEINLINE bool IsValid() const
+        {
+            return Get() != nullptr;
+        }
+
+        /**
+         * @brief Returns the entity index, whether or not the entity is still alive.
+        */
+        [[nodiscard]] constexpr int Index() const
+        {
+            return static_cast<int>(value_ & INDEX_MASK);
+        }
+
+        /**
+         * @brief Returns the packed handle.
+        */
+        [[nodiscard]] constexpr std::uint32_t Value() const
+        {
+            return value_;
+        }
+
+        constexpr bool operator==(const EntityHandle& other) const
+        {
+            return value_ == other.value_;
+        }
+
+        constexpr bool operator!=(const EntityHandle& other) const
+        {
+            return value_ != other.value_;
+        }
+
+    private:
+        /**
+         * @brief Generation in the high bits and index in the low bits; 0 is the null handle.
+        */
+        std::uint32_t value_{};
+    };
+
+    static_assert(sizeof(EntityHandle) == sizeof(std::uint32_t));
+}
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Fields of \c EntitySnapshot; combine them with <tt>|</tt>.
+    */
+    constexpr std::uint32_t SNAPSHOT_ORIGIN = 1U << 0;
+    constexpr std::uint32_t SNAPSHOT_VELOCITY = 1U << 1;
+    constexpr std::uint32_t SNAPSHOT_FLAGS = 1U << 2;
+    constexpr std::uint32_t SNAPSHOT_HEALTH = 1U << 3;
+    constexpr std::uint32_t SNAPSHOT_TEAM = 1U << 4;
+
+    /**
+     * @brief Alignment, in bytes, of the snapshot arrays.
+    */
+    constexpr std::size_t SNAPSHOT_ALIGNMENT = 64;
+
+    /**
+     * @brief Number of rows the snapshot arrays are padded to a multiple of.
+    */
+    constexpr std::size_t SNAPSHOT_ROW_PADDING = 16;
+
+    /**
+     * @brief Structure-of-arrays copy of the entity variables of the active entities, taken at \c StartFrame.
+     *
+     * Row \c N of every array belongs to \c entities[N]. The arrays are aligned to \c SNAPSHOT_ALIGNMENT bytes
+     * and zero-padded to a multiple of \c SNAPSHOT_ROW_PADDING rows, so vectorized loops need no remainder.
+     * The arrays of the fields that were not selected are \c nullptr.
+     *
+     * @code
+     * const auto& snapshot = metamod::engine::GetEntitySnapshot();
+     *
+     * for (std::size_t row = 0; row < snapshot.padded_count; ++row) {
+     *     speed_squared[row] = snapshot.velocity_x[row] * snapshot.velocity_x[row] +
+     *                          snapshot.velocity_y[row] * snapshot.velocity_y[row];
+     * }
+     * @endcode
+    */
+    struct EntitySnapshot
+    {
+        /**
+         * @brief Number of entities.
+        */
+        std::size_t count{};
+
+        /**
+         * @brief Number of rows including the padding.
+        */
+        std::size_t padded_count{};
+
+        /**
+         * @brief Selected fields.
+        */
+        std::uint32_t fields{};
+
+        /**
+         * @brief Incremented with every snapshot.
+        */
+        std::uint32_t frame{};
+
+        cssdk::Edict* const* entities{};
+
+        /**
+         * @brief Entity indices.
+        */
+        const int* indices{};
+
+        /**
+         * @brief For every row, the \c SNAPSHOT_ fields that changed since the previous snapshot;
+         * all selected fields for the entities that were not in the previous snapshot.
+        */
+        const std::uint32_t* dirty{};
+
+        const float* origin_x{};
+        const float* origin_y{};
+        const float* origin_z{};
+        const float* velocity_x{};
+        const float* velocity_y{};
+        const float* velocity_z{};
+        const int* flags{};
+        const float* health{};
+        const int* team{};
+    };
+
+    /**
+     * @brief Takes a snapshot of the given fields of all active entities at every \c StartFrame,
+     * before the \c StartFrame callbacks of this plugin run.
+     *
+     * @param fields \c SNAPSHOT_ fields to copy, or 0 to stop taking snapshots.
+    */
+    void EnableEntitySnapshot(std::uint32_t fields);
+
+    /**
+     * @brief Returns the latest snapshot; the pointers are valid until the next \c StartFrame.
+    */
+    const EntitySnapshot& GetEntitySnapshot();
+}
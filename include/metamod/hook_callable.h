@@ -0,0 +1,182 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/engine.h>
+#include <metamod/hook_chain.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace metamod::detail
+{
+    /**
+     * @brief Maximum number of callables of the same type installed on the same hook slot.
+    */
+    constexpr std::size_t MAX_CALLABLE_HOOKS = 16;
+
+    /**
+     * @brief Callables of type \c TCallable installed on the hook slot \c Member.
+     *
+     * Every callable is stored in a fixed slot and is called by a trampoline generated for that slot,
+     * so a call costs one plain function call plus the load of the callable's state.
+     * A slot is reused once its trampoline is no longer in the pre or post hook chain of \c Member.
+    */
+    template <auto Member, typename TCallable, typename TCallback = typename HookSlot<decltype(Member)>::Callback>
+    struct CallableHooks;
+
+    template <auto Member, typename TCallable, typename TRet, typename... TArgs>
+    struct CallableHooks<Member, TCallable, TRet (*)(TArgs...)>
+    {
+        using Callback = TRet (*)(TArgs...);
+
+        static inline std::array<std::optional<TCallable>, MAX_CALLABLE_HOOKS> callables{};
+
+        template <std::size_t Index>
+        static TRet Trampoline(TArgs... args)
+        {
+            return (*callables[Index])(std::forward<TArgs>(args)...);
+        }
+
+        template <std::size_t... Indices>
+        static constexpr std::array<Callback, MAX_CALLABLE_HOOKS> MakeTrampolines(std::index_sequence<Indices...>)
+        {
+            return {&Trampoline<Indices>...};
+        }
+
+        static constexpr auto TRAMPOLINES = MakeTrampolines(std::make_index_sequence<MAX_CALLABLE_HOOKS>{});
+
+        /**
+         * @brief Stores the callable in a free slot.
+         *
+         * @return The trampoline of the slot, or \c nullptr if all slots are in use.
+        */
+        template <typename T>
+        static Callback Add(T&& callable)
+        {
+            for (std::size_t i = 0; i < MAX_CALLABLE_HOOKS; ++i) {
+                if (!IsInstalled(TRAMPOLINES[i])) {
+                    callables[i].emplace(std::forward<T>(callable));
+                    return TRAMPOLINES[i];
+                }
+            }
+
+            return nullptr;
+        }
+
+    private:
+        static bool IsInstalled(const Callback trampoline)
+        {
+            const auto contains = [trampoline](const auto& entries) {
+                return std::any_of(entries.cbegin(), entries.cend(), [trampoline](const auto& entry) {
+                    return entry.callback == trampoline;
+                });
+            };
+
+            return contains(HookChain<Member, false>::entries) || contains(HookChain<Member, true>::entries);
+        }
+    };
+
+    /**
+     * @brief Callable that calls the member function \c Method of an object.
+    */
+    template <auto Method, typename TObject>
+    struct BoundMethod
+    {
+        TObject* object{};
+
+        /**
+         * @brief Forwards the arguments, so the out-parameters of the hook (e.g. \c cssdk::Vector&) reach the method.
+        */
+        template <typename... TArgs>
+        decltype(auto) operator()(TArgs&&... args) const
+        {
+            return (object->*Method)(std::forward<TArgs>(args)...);
+        }
+    };
+}
+
+namespace metamod
+{
+    /**
+     * @brief Adds a callable with state (e.g. a capturing lambda) to the hook slot \c Member.
+     *
+     * The callable is stored in static storage without heap allocation and is called through a generated
+     * trampoline. Up to \c MAX_CALLABLE_HOOKS callables of the same type can be installed on the same slot;
+     * the storage of a callable is reused once its trampoline has been removed from the slot.
+     *
+     * @code
+     * const auto think = metamod::HookCallable<&cssdk::DllFunctions::think>([this](cssdk::Edict* entity) {
+     *     OnThink(entity);
+     * }, false);
+     *
+     * metamod::RemoveHook<&cssdk::DllFunctions::think>(think, false);
+     * @endcode
+     *
+     * @tparam Member Pointer to the hook table member, e.g. \c &cssdk::DllFunctions::think.
+     *
+     * @param callable Callable invocable with the arguments of the hook.
+     * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
+     *
+     * @return The installed trampoline, which can be passed to \c RemoveHook, or \c nullptr on failure.
+    */
+    template <auto Member, typename TCallable>
+    typename detail::HookSlot<decltype(Member)>::Callback HookCallable(TCallable&& callable, const bool post,
+                                                                        const int priority = 0)
+    {
+        static_assert(detail::IS_CHAINABLE_HOOK<typename detail::HookSlot<decltype(Member)>::Callback>,
+                      "Variadic hook slots cannot call callables.");
+
+        const auto trampoline = detail::CallableHooks<Member, std::decay_t<TCallable>>::Add(std::forward<TCallable>(callable));
+
+        if (trampoline == nullptr) {
+            engine::AlertMessage(cssdk::AlertType::Logged, "Hook callable: too many callables of the same type; maximum = %d.\n",
+                                 static_cast<int>(detail::MAX_CALLABLE_HOOKS));
+        }
+        else {
+            detail::SetSlotHook<Member>(trampoline, post, priority);
+        }
+
+        return trampoline;
+    }
+
+    /**
+     * @brief Adds the member function \c Method of \c object to the hook slot \c Member.
+     *
+     * @tparam Member Pointer to the hook table member, e.g. \c &cssdk::DllFunctions::think.
+     * @tparam Method Pointer to the member function, e.g. \c &ZombieMode::OnThink.
+     *
+     * @param object The object the member function is called on; must outlive the hook.
+     * @param post Is this a post hook?
+     * @param priority Callbacks of this hook with a higher priority are called first.
+     *
+     * @return The installed trampoline, which can be passed to \c RemoveHook, or \c nullptr on failure.
+    */
+    template <auto Member, auto Method, typename TObject>
+    typename detail::HookSlot<decltype(Member)>::Callback HookMethod(TObject* const object, const bool post,
+                                                                      const int priority = 0)
+    {
+        return HookCallable<Member>(detail::BoundMethod<Method, TObject>{object}, post, priority);
+    }
+}
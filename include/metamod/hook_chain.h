@@ -0,0 +1,363 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <metamod/api.h>
+#include <metamod/hook_profiler.h>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace metamod::detail
+{
+    /**
+     * @brief Splits a pointer to a hook table member into the table type and the callback type.
+    */
+    template <typename TMember>
+    struct HookSlot;
+
+    template <typename TTable, typename TCallback>
+    struct HookSlot<TCallback TTable::*>
+    {
+        using Table = TTable;
+        using Callback = TCallback;
+    };
+
+    /**
+     * @brief Whether several callbacks can be chained on a hook slot of the given callback type.
+     * C-style variadic slots cannot forward their arguments, so they keep a single callback.
+    */
+    template <typename TCallback>
+    constexpr bool IS_CHAINABLE_HOOK = false;
+
+    template <typename TRet, typename... TArgs>
+    constexpr bool IS_CHAINABLE_HOOK<TRet (*)(TArgs...)> = true;
+
+    /**
+     * @brief Intrusive list node used to reset every hook chain of a table.
+    */
+    template <typename TTable>
+    struct HookChainNode
+    {
+        void (*reset)(TTable* table, bool remove_internal){};
+        bool post{};
+        HookChainNode* next{};
+    };
+
+    /**
+     * @brief Head of the list of the hook chains created for the given table type.
+    */
+    template <typename TTable>
+    inline HookChainNode<TTable>* hook_chains{};
+
+    /**
+     * @brief Removes the callbacks from the pre or post hook chains of the given table type.
+     *
+     * The hooks the SDK installs for its own facilities are kept unless \c remove_internal is set, and are
+     * written back into \c table, which must already be cleared or overwritten by the caller.
+    */
+    template <typename TTable>
+    void ResetHookChains(TTable* const table, const bool post, const bool remove_internal = false)
+    {
+        for (auto* node = hook_chains<TTable>; node != nullptr; node = node->next) {
+            if (node->post == post) {
+                node->reset(table, remove_internal);
+            }
+        }
+    }
+
+    /**
+     * @brief Links the node into the list of the hook chains of the given table type.
+    */
+    template <typename TTable>
+    void RegisterHookChain(HookChainNode<TTable>& node, void (*const reset)(TTable*, bool), const bool post)
+    {
+        if (node.reset == nullptr) {
+            node.reset = reset;
+            node.post = post;
+            node.next = hook_chains<TTable>;
+            hook_chains<TTable> = &node;
+        }
+    }
+
+    /**
+     * @brief Number of \c HookChain::Dispatch calls on the stack.
+    */
+    inline int dispatch_depth{};
+
+    /**
+     * @brief Called once when the outermost \c HookChain::Dispatch returns, then reset.
+     * Used to defer changes that would remove entries from a chain while it is being dispatched.
+    */
+    inline void (*deferred_dispatch_action)(){};
+
+    /**
+     * @brief Tracks the dispatch depth and runs the deferred action when the outermost dispatch returns.
+    */
+    struct DispatchScope
+    {
+        DispatchScope()
+        {
+            ++dispatch_depth;
+        }
+
+        ~DispatchScope()
+        {
+            if (--dispatch_depth == 0 && deferred_dispatch_action != nullptr) {
+                const auto action = deferred_dispatch_action;
+                deferred_dispatch_action = nullptr;
+                action();
+            }
+        }
+
+        DispatchScope(const DispatchScope&) = delete;
+        DispatchScope& operator=(const DispatchScope&) = delete;
+    };
+
+    /**
+     * @brief Callback entry of a hook chain.
+    */
+    template <typename TCallback>
+    struct HookEntry
+    {
+        TCallback callback{};
+        int priority{};
+
+        /**
+         * @brief Installed by the SDK itself; kept when the hooks of the plugin are reset.
+        */
+        bool internal{};
+    };
+
+    /**
+     * @brief Callbacks installed on a single hook slot, sorted by descending priority.
+     *
+     * A slot with one callback has that callback written directly into the hook table, so it costs
+     * nothing extra. A slot with several callbacks gets \c Dispatch installed instead, which calls them
+     * in priority order and merges their meta results the way Metamod merges the results of plugins.
+     * A callback that sets \c Result::Supercede stops the remaining callbacks of the chain.
+     *
+     * With \c META_HOOK_PROFILER, \c Dispatch is installed for any number of callbacks and times every call of the slot.
+    */
+    template <auto Member, bool Post, typename TCallback = typename HookSlot<decltype(Member)>::Callback>
+    struct HookChain;
+
+    template <auto Member, bool Post, typename TRet, typename... TArgs>
+    struct HookChain<Member, Post, TRet (*)(TArgs...)>
+    {
+        using Table = typename HookSlot<decltype(Member)>::Table;
+        using Callback = TRet (*)(TArgs...);
+        using Entry = HookEntry<Callback>;
+
+        static inline std::vector<Entry> entries{};
+        static inline HookChainNode<Table> node{};
+
+#ifdef META_HOOK_PROFILER
+        static inline HookProfile profile{};
+#endif
+
+        /**
+         * @brief Adds the callback to the chain, or removes all callbacks of the plugin if \c callback is \c nullptr.
+         * Adding a callback that is already in the chain changes its priority.
+         *
+         * @param internal Whether the callback is installed by the SDK itself and survives the resets.
+        */
+        static void Set(Table* const table, const Callback callback, const int priority, const bool internal = false)
+        {
+            if (callback == nullptr) {
+                EraseCallbacksOfPlugin();
+            }
+            else {
+                RegisterHookChain<Table>(node, &Reset, Post);
+#ifdef META_HOOK_PROFILER
+                RegisterHookProfile(profile, HookSlotName<Member>(), Post);
+#endif
+                Adopt(table);
+                Erase(callback);
+                Insert(Entry{callback, priority, internal});
+            }
+
+            Install(table);
+        }
+
+        /**
+         * @brief Removes the callback from the chain.
+        */
+        static void Remove(Table* const table, const Callback callback)
+        {
+            Erase(callback);
+            Install(table);
+        }
+
+        /**
+         * @brief Writes the chain into the hook table.
+        */
+        static void Install(Table* const table)
+        {
+            switch (entries.size()) {
+            case 0:
+                table->*Member = nullptr;
+                break;
+
+#ifndef META_HOOK_PROFILER
+            case 1:
+                table->*Member = entries.front().callback;
+                break;
+#endif
+
+            default:
+                table->*Member = &Dispatch;
+                break;
+            }
+        }
+
+        /**
+         * @brief Calls the callbacks of the chain until one of them supercedes the call.
+        */
+        static TRet Dispatch(TArgs... args)
+        {
+#ifdef META_HOOK_PROFILER
+            const HookTimer timer{profile};
+#endif
+            const DispatchScope scope{};
+            auto status = Result::Unset;
+
+            if constexpr (std::is_void_v<TRet>) {
+                // Index-based loop: a callback may add hooks to this chain while it is being dispatched.
+                for (std::size_t i = 0; i < entries.size() && status < Result::Supercede; ++i) {
+                    g_globals->result = Result::Unset;
+                    entries[i].callback(args...);
+                    status = std::max(status, g_globals->result);
+                }
+
+                g_globals->result = status;
+            }
+            else {
+                TRet ret{};
+
+                for (std::size_t i = 0; i < entries.size() && status < Result::Supercede; ++i) {
+                    g_globals->result = Result::Unset;
+                    auto value = entries[i].callback(args...);
+
+                    if (g_globals->result >= Result::Override) {
+                        ret = value;
+                    }
+
+                    status = std::max(status, g_globals->result);
+                }
+
+                g_globals->result = status;
+                return ret;
+            }
+        }
+
+    private:
+        static void Reset(Table* const table, const bool remove_internal)
+        {
+            if (remove_internal) {
+                entries.clear();
+                return;
+            }
+
+            EraseCallbacksOfPlugin();
+
+            if (table != nullptr && !entries.empty()) {
+                Adopt(table);
+                Install(table);
+            }
+        }
+
+        /**
+         * @brief Adopts a callback that was written into the table directly (e.g. by \c SetHookTable).
+        */
+        static void Adopt(const Table* const table)
+        {
+            const auto callback = table->*Member;
+
+            if (callback == nullptr || callback == &Dispatch) {
+                return;
+            }
+
+            if (std::none_of(entries.cbegin(), entries.cend(), [callback](const Entry& entry) { return entry.callback == callback; })) {
+                Insert(Entry{callback, 0});
+            }
+        }
+
+        static void Insert(const Entry& entry)
+        {
+            // Callbacks of equal priority keep their registration order.
+            const auto pos = std::find_if(entries.cbegin(), entries.cend(), [&entry](const Entry& other) {
+                return other.priority < entry.priority;
+            });
+
+            entries.insert(pos, entry);
+        }
+
+        static void EraseCallbacksOfPlugin()
+        {
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) {
+                return !entry.internal;
+            }), entries.end());
+        }
+
+        static void Erase(const Callback callback)
+        {
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [callback](const Entry& entry) {
+                return entry.callback == callback;
+            }), entries.end());
+        }
+    };
+
+    /**
+     * @brief Adds a callback to the hook slot \c Member of the given table.
+     *
+     * @param table Hook table (pre or post, as specified by \c Post).
+     * @param callback The callback function pointer or \c nullptr to remove all callbacks of the plugin from this slot.
+     * @param priority Callbacks with a higher priority are called first.
+     * @param internal Whether the callback is installed by the SDK itself and survives the resets.
+    */
+    template <auto Member, bool Post, typename TCallback>
+    void SetHook(typename HookSlot<decltype(Member)>::Table* const table, const TCallback callback, const int priority,
+                 const bool internal = false)
+    {
+        if constexpr (IS_CHAINABLE_HOOK<typename HookSlot<decltype(Member)>::Callback>) {
+            HookChain<Member, Post>::Set(table, callback, priority, internal);
+        }
+        else {
+            table->*Member = callback;
+        }
+    }
+
+    /**
+     * @brief Removes a callback from the hook slot \c Member of the given table.
+     *
+     * @param table Hook table (pre or post, as specified by \c Post).
+     * @param callback The callback function pointer to remove.
+    */
+    template <auto Member, bool Post, typename TCallback>
+    void RemoveHook(typename HookSlot<decltype(Member)>::Table* const table, const TCallback callback)
+    {
+        if constexpr (IS_CHAINABLE_HOOK<typename HookSlot<decltype(Member)>::Callback>) {
+            HookChain<Member, Post>::Remove(table, callback);
+        }
+        else if (table->*Member == callback) {
+            table->*Member = nullptr;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <metamod/config.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#ifdef META_HOOK_PROFILER
+
+namespace metamod::detail
+{
+    /**
+     * @brief Number of latency histogram buckets; bucket \c N counts the calls that took [2^(N-1), 2^N) ns.
+    */
+    constexpr std::size_t HOOK_PROFILE_BUCKETS = 32;
+
+    /**
+     * @brief Timing statistics of a hook slot.
+    */
+    struct HookProfile
+    {
+        /**
+         * @brief Slot name, e.g. "DllFunctions::player_post_think".
+        */
+        std::string_view name{};
+
+        /**
+         * @brief Is this a post hook slot?
+        */
+        bool post{};
+
+        /**
+         * @brief Number of calls.
+        */
+        std::uint64_t calls{};
+
+        /**
+         * @brief Total time spent in the callbacks of the slot, in nanoseconds.
+        */
+        std::uint64_t total_ns{};
+
+        /**
+         * @brief Longest call, in nanoseconds.
+        */
+        std::uint64_t max_ns{};
+
+        /**
+         * @brief Latency histogram.
+        */
+        std::array<std::uint64_t, HOOK_PROFILE_BUCKETS> histogram{};
+
+        /**
+         * @brief Next profile in the list of all profiles.
+        */
+        HookProfile* next{};
+    };
+
+    /**
+     * @brief Head of the list of the profiled hook slots.
+    */
+    inline HookProfile* hook_profiles{};
+
+    /**
+     * @brief Returns the name of the hook table member \c Member.
+    */
+    template <auto Member>
+    std::string_view HookSlotName()
+    {
+#ifdef _MSC_VER
+        constexpr std::string_view signature = __FUNCSIG__;
+#else
+        constexpr std::string_view signature = __PRETTY_FUNCTION__;
+#endif
+        // The signature ends with the template argument, e.g. "... [with auto Member = &cssdk::DllFunctions::think; ...]".
+        const auto begin = signature.find("cssdk::");
+        const auto end = signature.find_first_of(";]>", begin);
+
+        if (begin == std::string_view::npos || end == std::string_view::npos) {
+            return signature;
+        }
+
+        return signature.substr(begin + 7, end - begin - 7);
+    }
+
+    /**
+     * @brief Links the profile into the list of all profiles.
+    */
+    inline void RegisterHookProfile(HookProfile& profile, const std::string_view name, const bool post)
+    {
+        if (profile.name.empty()) {
+            profile.name = name;
+            profile.post = post;
+            profile.next = hook_profiles;
+            hook_profiles = &profile;
+        }
+    }
+
+    /**
+     * @brief Measures the time of a hook slot call and adds it to the profile of the slot.
+    */
+    class HookTimer
+    {
+    public:
+        explicit HookTimer(HookProfile& profile)
+            : profile_(profile), start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        HookTimer(const HookTimer&) = delete;
+        HookTimer& operator=(const HookTimer&) = delete;
+
+        ~HookTimer()
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            const auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+            std::size_t bucket = 0;
+
+            for (auto value = ns; value != 0 && bucket < HOOK_PROFILE_BUCKETS - 1; value >>= 1) {
+                ++bucket;
+            }
+
+            ++profile_.calls;
+            profile_.total_ns += ns;
+            ++profile_.histogram[bucket];
+
+            if (ns > profile_.max_ns) {
+                profile_.max_ns = ns;
+            }
+        }
+
+    private:
+        HookProfile& profile_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * @brief Server command: prints the hook slots with the highest total time.
+     * Usage: <command> [count = 10] [reset]
+    */
+    void DumpHookProfiles();
+}
+
+#endif
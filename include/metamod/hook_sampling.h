@@ -0,0 +1,303 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_chain.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace metamod
+{
+    /**
+     * @brief How often a sampled hook callback is called.
+    */
+    struct HookSampling
+    {
+        /**
+         * @brief The callback is called on every \c period-th call of the hook.
+        */
+        std::uint32_t period{1};
+
+        /**
+         * @brief If greater than zero, the callback is called on each call of the hook with this probability
+         * and \c period is not used.
+        */
+        double probability{};
+    };
+}
+
+namespace metamod::detail
+{
+    /**
+     * @brief State of the random number generator of the sampled hooks (xorshift32).
+    */
+    inline std::uint32_t sampling_random_state{0x9E3779B9U};
+
+    /**
+     * @brief Returns the number of hook calls until the next sample.
+    */
+    inline std::uint32_t NextSamplingInterval(const HookSampling& sampling)
+    {
+        if (sampling.probability <= 0.0) {
+            return std::max<std::uint32_t>(sampling.period, 1);
+        }
+
+        if (sampling.probability >= 1.0) {
+            return 1;
+        }
+
+        auto& state = sampling_random_state;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        // The distance between two samples of a Bernoulli process is geometrically distributed.
+        const auto uniform = (static_cast<double>(state) + 1.0) / 4294967296.0;
+        const auto interval = 1.0 + std::floor(std::log(uniform) / std::log1p(-sampling.probability));
+
+        return interval < 4294967295.0 ? static_cast<std::uint32_t>(interval) : UINT32_MAX;
+    }
+
+    /**
+     * @brief Sampled callbacks of a hook slot, dispatched together from a single entry of the slot's hook chain.
+     *
+     * A single countdown of the slot is decremented on every call; the callbacks are only looked at
+     * when it reaches zero, i.e. when at least one of them is due.
+     * Sampled callbacks are observers: their meta results and return values are ignored.
+    */
+    template <auto Member, bool Post, typename TCallback = typename HookSlot<decltype(Member)>::Callback>
+    struct SampledHookChain;
+
+    template <auto Member, bool Post, typename TRet, typename... TArgs>
+    struct SampledHookChain<Member, Post, TRet (*)(TArgs...)>
+    {
+        using Table = typename HookSlot<decltype(Member)>::Table;
+        using Callback = TRet (*)(TArgs...);
+
+        struct Entry
+        {
+            Callback callback{};
+            HookSampling sampling{};
+
+            /**
+             * @brief Calls of the slot until the next sample of this callback.
+            */
+            std::uint32_t countdown{};
+
+            bool due{};
+        };
+
+        static inline std::vector<Entry> entries{};
+        static inline HookChainNode<Table> node{};
+
+        /**
+         * @brief Length of the current countdown of the slot.
+        */
+        static inline std::uint32_t scheduled{};
+
+        /**
+         * @brief Calls of the slot until the end of the current countdown.
+        */
+        static inline std::uint32_t remaining{};
+
+        /**
+         * @brief Adds the callback, or removes all sampled callbacks if \c callback is \c nullptr.
+        */
+        static void Set(const Callback callback, const HookSampling& sampling, const int priority)
+        {
+            if (callback == nullptr) {
+                Reset(nullptr, false);
+                RemoveSlotHook<Member>(&Dispatch, Post);
+                return;
+            }
+
+            RegisterHookChain<Table>(node, &Reset, Post);
+            Advance(scheduled - remaining);
+
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [callback](const Entry& entry) {
+                return entry.callback == callback;
+            }), entries.end());
+
+            entries.push_back(Entry{callback, sampling, NextSamplingInterval(sampling), false});
+            Schedule();
+
+            SetSlotHook<Member>(&Dispatch, Post, priority);
+        }
+
+        /**
+         * @brief Counts the call and calls the sampled callbacks that are due.
+        */
+        static TRet Dispatch(TArgs... args)
+        {
+            if (--remaining == 0) {
+                Sample(args...);
+            }
+
+            g_globals->result = Result::Ignored;
+
+            if constexpr (!std::is_void_v<TRet>) {
+                return TRet{};
+            }
+        }
+
+    private:
+        static void Sample(TArgs... args)
+        {
+            for (auto& entry : entries) {
+                entry.countdown -= scheduled;
+
+                if (entry.countdown == 0) {
+                    entry.countdown = NextSamplingInterval(entry.sampling);
+                    entry.due = true;
+                }
+            }
+
+            Schedule();
+
+            // Index-based loop: a callback may add sampled callbacks to this slot.
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                if (entries[i].due) {
+                    entries[i].due = false;
+                    entries[i].callback(args...);
+                }
+            }
+        }
+
+        /**
+         * @brief Accounts for the calls made since the start of the current countdown.
+        */
+        static void Advance(const std::uint32_t calls)
+        {
+            for (auto& entry : entries) {
+                entry.countdown -= calls;
+            }
+        }
+
+        static void Schedule()
+        {
+            scheduled = 0;
+
+            for (const auto& entry : entries) {
+                if (scheduled == 0 || entry.countdown < scheduled) {
+                    scheduled = entry.countdown;
+                }
+            }
+
+            remaining = scheduled;
+        }
+
+        static void Reset(Table*, bool)
+        {
+            entries.clear();
+            scheduled = remaining = 0;
+        }
+    };
+}
+
+namespace metamod
+{
+    /**
+     * @brief Adds a callback to the hook slot \c Member that is called only on a sample of the calls.
+     * Sampled callbacks are observers: their meta results and return values are ignored.
+     *
+     * @tparam Member Pointer to the hook table member, e.g. \c &cssdk::DllFunctions::add_to_full_pack.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all sampled callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param sampling How often the callback is called.
+     * @param priority Priority of the sampled callbacks of this hook among its other callbacks.
+    */
+    template <auto Member>
+    void HookSampled(const typename detail::HookSlot<decltype(Member)>::Callback callback, const bool post,
+                     const HookSampling& sampling, const int priority = 0)
+    {
+        static_assert(detail::IS_CHAINABLE_HOOK<typename detail::HookSlot<decltype(Member)>::Callback>,
+                      "Variadic hook slots cannot be sampled.");
+
+        if (post) {
+            detail::SampledHookChain<Member, true>::Set(callback, sampling, priority);
+        }
+        else {
+            detail::SampledHookChain<Member, false>::Set(callback, sampling, priority);
+        }
+    }
+}
+
+namespace metamod::engine
+{
+    /**
+     * @brief Performs a trace between a starting and ending position.
+     * The callback is called only on a sample of the calls; its meta result is ignored.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all sampled callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param sampling How often the callback is called.
+     * @param priority Priority of the sampled callbacks of this hook among its other callbacks.
+    */
+    inline void HookTraceLine(
+        const std::add_pointer_t<void(const cssdk::Vector& start_pos, const cssdk::Vector& end_pos, int trace_ignore_flags, cssdk::Edict* entity_to_ignore, cssdk::TraceResult* result)> callback,
+        const bool post, const HookSampling& sampling, const int priority = 0)
+    {
+        HookSampled<&cssdk::EngineFunctions::trace_line>(callback, post, sampling, priority);
+    }
+}
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Called by the engine to determine whether the given entity should be added
+     * to the given client's list of visible entities.
+     * The callback is called only on a sample of the calls; its meta result and return value are ignored.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all sampled callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param sampling How often the callback is called.
+     * @param priority Priority of the sampled callbacks of this hook among its other callbacks.
+    */
+    inline void HookAddToFullPack(
+        const std::add_pointer_t<cssdk::qboolean(cssdk::EntityState* state, int entity_index, cssdk::Edict* entity, cssdk::Edict* host, int host_flags, cssdk::qboolean player, unsigned char* set)> callback,
+        const bool post, const HookSampling& sampling, const int priority = 0)
+    {
+        HookSampled<&cssdk::DllFunctions::add_to_full_pack>(callback, post, sampling, priority);
+    }
+
+    /**
+     * @brief Called by the engine when a user command has been received and is about to begin processing.
+     * The callback is called only on a sample of the calls; its meta result is ignored.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all sampled callbacks of this hook.
+     * @param post Is this a post hook?
+     * @param sampling How often the callback is called.
+     * @param priority Priority of the sampled callbacks of this hook among its other callbacks.
+    */
+    inline void HookCmdStart(const std::add_pointer_t<void(const cssdk::Edict* client, const cssdk::UserCmd* cmd, unsigned int random_seed)> callback,
+                             const bool post, const HookSampling& sampling, const int priority = 0)
+    {
+        HookSampled<&cssdk::DllFunctions::cmd_start>(callback, post, sampling, priority);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_chain.h>
+#include <type_traits>
+
+namespace metamod::detail
+{
+    /**
+     * @brief Adds a callback to the hook slot \c Member of the engine or game DLL hook tables.
+    */
+    template <auto Member, typename TCallback>
+    void SetSlotHook(const TCallback callback, const bool post, const int priority, const bool internal = false)
+    {
+        if constexpr (std::is_same_v<typename HookSlot<decltype(Member)>::Table, cssdk::EngineFunctions>) {
+            engine::detail::SetHook<Member>(callback, post, priority, internal);
+        }
+        else {
+            gamedll::detail::SetHook<Member>(callback, post, priority, internal);
+        }
+    }
+
+    /**
+     * @brief Adds a callback of an SDK facility to the hook slot \c Member.
+     *
+     * Unlike the hooks of the plugin, it survives \c SetHookTable, the hook transactions and the
+     * clearing of the hook tables, so the facility can install it only once.
+    */
+    template <auto Member>
+    void SetInternalHook(const typename HookSlot<decltype(Member)>::Callback callback, const bool post,
+                         const int priority = 0)
+    {
+        SetSlotHook<Member>(callback, post, priority, true);
+    }
+
+    /**
+     * @brief Removes a callback from the hook slot \c Member of the engine or game DLL hook tables.
+    */
+    template <auto Member, typename TCallback>
+    void RemoveSlotHook(const TCallback callback, const bool post)
+    {
+        if constexpr (std::is_same_v<typename HookSlot<decltype(Member)>::Table, cssdk::EngineFunctions>) {
+            engine::detail::RemoveHook<Member>(callback, post);
+        }
+        else {
+            gamedll::detail::RemoveHook<Member>(callback, post);
+        }
+    }
+}
+
+namespace metamod
+{
+    /**
+     * @brief Removes a single callback from the hook slot \c Member, keeping its other callbacks.
+     *
+     * @tparam Member Pointer to the hook table member, e.g. \c &cssdk::DllFunctions::think.
+     *
+     * @param callback The callback function pointer to remove.
+     * @param post Is this a post hook?
+    */
+    template <auto Member>
+    void RemoveHook(const typename detail::HookSlot<decltype(Member)>::Callback callback, const bool post)
+    {
+        detail::RemoveSlotHook<Member>(callback, post);
+    }
+}
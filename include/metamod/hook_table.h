@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <metamod/hook_chain.h>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace metamod
+{
+    /**
+     * @brief Declares a hook: the hook table slot and the function installed into it.
+     *
+     * @tparam Slot Pointer to the hook table member, e.g. \c &cssdk::DllFunctions::player_post_think.
+     * @tparam Function Callback function pointer.
+    */
+    template <auto Slot, auto Function>
+    struct Hook
+    {
+        using Table = typename detail::HookSlot<decltype(Slot)>::Table;
+        using Callback = typename detail::HookSlot<decltype(Slot)>::Callback;
+
+        static_assert(std::is_convertible_v<decltype(Function), Callback>, "Function does not match the hook slot.");
+
+        static constexpr auto SLOT = Slot;
+        static constexpr Callback FUNCTION = Function;
+    };
+
+    /**
+     * @brief Hook table built at compile time from a list of \c Hook declarations.
+     *
+     * The table is a constant in static storage: installing it with \c SetHookTable is a single copy
+     * and does not allocate, and whether a slot is used is known at compile time.
+     *
+     * @code
+     * using PlayerHooks = metamod::HookTable<metamod::Hook<&cssdk::DllFunctions::player_pre_think, &OnPreThink>,
+     *                                        metamod::Hook<&cssdk::DllFunctions::player_post_think, &OnPostThink>>;
+     *
+     * static_assert(!PlayerHooks::IsHooked<&cssdk::DllFunctions::think>());
+     * metamod::gamedll::SetHookTable<PlayerHooks>(false);
+     * @endcode
+    */
+    template <typename THook, typename... THooks>
+    struct HookTable
+    {
+        using Table = typename THook::Table;
+
+        static_assert((std::is_same_v<Table, typename THooks::Table> && ...), "All hooks must belong to the same table.");
+
+        /**
+         * @brief Number of declared hooks.
+        */
+        static constexpr std::size_t SIZE = 1 + sizeof...(THooks);
+
+        /**
+         * @brief The hook table.
+        */
+        static constexpr Table TABLE = [] {
+            Table table{};
+            table.*THook::SLOT = THook::FUNCTION;
+            ((table.*THooks::SLOT = THooks::FUNCTION), ...);
+            return table;
+        }();
+
+        /**
+         * @brief Whether the given slot has a hook in this table.
+        */
+        template <auto Slot>
+        static constexpr bool IsHooked()
+        {
+            return TABLE.*Slot != nullptr;
+        }
+    };
+}
+
+namespace metamod::detail
+{
+    /**
+     * @brief Whether no hook is installed in the given table.
+    */
+    template <typename TTable>
+    bool IsHookTableEmpty(const TTable& table)
+    {
+        static const TTable empty{};
+        return std::memcmp(&table, &empty, sizeof(TTable)) == 0;
+    }
+
+    /**
+     * @brief Logs that the hooks of a table that was not exported to Metamod were changed.
+    */
+    void ReportSkippedHookTable(const char* table_name);
+
+    /**
+     * @brief Reports the first change of the hooks of a table skipped at attach time.
+     *
+     * @param skipped Whether the table was skipped; cleared after the report.
+     * @param table_name Table name for the log message.
+    */
+    inline void CheckSkippedHookTable(bool& skipped, const char* const table_name)
+    {
+        if (skipped) {
+            skipped = false;
+            ReportSkippedHookTable(table_name);
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+
+namespace metamod
+{
+    /**
+     * @brief Stages a group of hook changes to be applied in one step at the start of the next frame.
+     *
+     * \c changes calls the usual \c Hook* / \c SetHookTable functions. At the next \c StartFrame all staged
+     * groups are run, in staging order, against scratch copies of the engine and game DLL hook tables, and
+     * each table is then copied back into the table owned by Metamod at once, so the engine never calls
+     * into a half-updated hook table. If \c StartFrame has several callbacks, the changes are applied once they have all
+     * been called, so they take effect from the next hooked call after \c StartFrame.
+     *
+     * @code
+     * metamod::StageHooks([] {
+     *     metamod::gamedll::HookThink(OnZombieThink, false);
+     *     metamod::engine::HookTraceLine(OnZombieTraceLine, true);
+     * }, true);
+     * @endcode
+     *
+     * @param changes Function that makes the hook changes.
+     * @param replace If \c true, all hooks of the plugin are removed before \c changes is run, so it builds a complete
+     * replacement set. The hooks installed by the SDK facilities are kept.
+    */
+    void StageHooks(std::function<void()> changes, bool replace = false);
+
+    /**
+     * @brief Applies the staged hook changes now instead of at the next \c StartFrame.
+     * Called from a hook that is dispatched among several callbacks, the changes are applied when the dispatch returns.
+    */
+    void CommitStagedHooks();
+}
@@ -0,0 +1,360 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <metamod/multicast.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Type of a message field, as written by the corresponding \c Write* function.
+    */
+    enum class MessageField : std::uint8_t
+    {
+        Byte,
+        Char,
+        Short,
+        Long,
+        Angle,
+        Coord,
+        String,
+        Entity
+    };
+
+    /**
+     * @brief How a prepared message is written to the engine.
+    */
+    enum class MessageReplay
+    {
+        /**
+         * @brief \c Packed, unless the message ID is intercepted by \c HookMessage of this plugin,
+         * whose handlers decode the fields; then \c Fields.
+        */
+        Auto,
+
+        /**
+         * @brief Every field is written with its original \c Write* function, so the message hooks of other
+         * plugins see the message exactly as if it was written directly; one engine call per field.
+        */
+        Fields,
+
+        /**
+         * @brief The encoded bytes are written with \c WriteLong / \c WriteByte; fewest engine calls.
+         * The bytes on the wire are the same, but plugins that parse the fields of messages
+         * (e.g. message hooks of other plugins) see longs and bytes instead of the original fields.
+        */
+        Packed
+    };
+
+    /**
+     * @brief Maximum size of a prepared message, in bytes; the engine's limit for user messages.
+    */
+    constexpr std::size_t MAX_MESSAGE_SIZE = 192;
+
+    /**
+     * @brief Writes encoded message bytes to the message begun by the caller with \c WriteLong / \c WriteByte.
+    */
+    void WritePacked(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Writes a message saved by \c MessageBuilder::Save to the message begun by the caller.
+     *
+     * @param replay The replay returned by \c MessageBuilder::Save.
+    */
+    void WriteSavedMessage(const std::uint8_t* data, std::size_t size, MessageReplay replay);
+
+    /**
+     * @brief Network message that is encoded once and can be sent to any number of recipients.
+     *
+     * The fields are encoded into a local buffer exactly like the engine encodes them, so sending the message
+     * only writes the prepared bytes, four per engine call. Messages that must reach the message hooks
+     * of other plugins field by field are sent with \c MessageReplay::Fields.
+     *
+     * @code
+     * metamod::engine::MessageBuilder message{msg_id};
+     * message.WriteByte(1).WriteCoord(origin).WriteString("text");
+     *
+     * for (auto* client : clients) {
+     *     message.Send(cssdk::MessageType::One, client);
+     * }
+     * @endcode
+    */
+    class MessageBuilder
+    {
+    public:
+        MessageBuilder() = default;
+
+        /**
+         * @param msg_id Message ID.
+        */
+        explicit MessageBuilder(const int msg_id)
+            : msg_id_(msg_id)
+        {
+        }
+
+        /**
+         * @brief Clears the message and sets its ID.
+        */
+        void Reset(const int msg_id)
+        {
+            msg_id_ = msg_id;
+            size_ = 0;
+            field_count_ = 0;
+            overflowed_ = false;
+        }
+
+        /**
+         * @brief Writes a single unsigned byte.
+        */
+        MessageBuilder& WriteByte(const int value)
+        {
+            if (AddField(MessageField::Byte, 1, value, 0.0F)) {
+                Put(value, 1);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a single character.
+        */
+        MessageBuilder& WriteChar(const int value)
+        {
+            if (AddField(MessageField::Char, 1, value, 0.0F)) {
+                Put(value, 1);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a single unsigned short.
+        */
+        MessageBuilder& WriteShort(const int value)
+        {
+            if (AddField(MessageField::Short, 2, value, 0.0F)) {
+                Put(value, 2);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a single unsigned int.
+        */
+        MessageBuilder& WriteLong(const int value)
+        {
+            if (AddField(MessageField::Long, 4, value, 0.0F)) {
+                Put(value, 4);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a single angle value.
+        */
+        MessageBuilder& WriteAngle(const float value)
+        {
+            if (AddField(MessageField::Angle, 1, 0, value)) {
+                Put(static_cast<int>(static_cast<std::int64_t>(value * 256.0 / 360.0) & 0xFF), 1);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a single coordinate value.
+        */
+        MessageBuilder& WriteCoord(const float value)
+        {
+            if (AddField(MessageField::Coord, 2, 0, value)) {
+                Put(static_cast<int>(value * 8.0), 2);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Writes a coordinates (x, y, z).
+        */
+        MessageBuilder& WriteCoord(const cssdk::Vector& value)
+        {
+            return WriteCoord(value.x).WriteCoord(value.y).WriteCoord(value.z);
+        }
+
+        /**
+         * @brief Writes a single null terminated string; \c nullptr is written as an empty string.
+        */
+        MessageBuilder& WriteString(const char* value);
+
+        /**
+         * @brief Writes a single entity index.
+        */
+        MessageBuilder& WriteEntity(const int value)
+        {
+            if (AddField(MessageField::Entity, 2, value, 0.0F)) {
+                Put(value, 2);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Sends the message.
+         *
+         * @param msg_type Message type.
+         * @param client If it's a message to one client, client to send the message to (optional).
+         * @param origin Origin to use for PVS and PAS checks (optional).
+         * @param replay How the message is written to the engine.
+         *
+         * @note A message that overflowed is not sent; the error is logged.
+        */
+        void Send(cssdk::MessageType msg_type, cssdk::Edict* client = nullptr, const float* origin = nullptr,
+                  MessageReplay replay = MessageReplay::Auto) const;
+
+        /**
+         * @brief Sends the message to each of the given clients.
+         *
+         * @param clients Clients to send the message to.
+         * @param count Number of clients.
+         * @param reliable Whether the message is sent reliably (\c One) or unreliably (\c OneUnreliable).
+         * @param replay How the message is written to the engine.
+        */
+        void SendTo(cssdk::Edict* const* clients, std::size_t count, bool reliable = true,
+                    MessageReplay replay = MessageReplay::Auto) const;
+
+        /**
+         * @brief Sends the message to a set of clients using the cheapest message type (see \c MessageMulticast).
+         *
+         * @param clients Clients to send the message to.
+         * @param reliable Whether the message is sent reliably.
+         * @param replay How the message is written to the engine.
+        */
+        void SendTo(ClientMask clients, bool reliable = true, MessageReplay replay = MessageReplay::Auto) const;
+
+        /**
+         * @brief Writes the fields of the message to the message begun by the caller.
+        */
+        void WriteTo(MessageReplay replay = MessageReplay::Auto) const;
+
+        /**
+         * @brief Appends the message to \c buffer in a compact form, for messages that are sent later.
+         *
+         * With \c MessageReplay::Fields, every field is stored as its type followed by its value;
+         * with \c MessageReplay::Packed, only the encoded bytes are stored.
+         *
+         * @return The replay the message was saved with, to pass to \c WriteSavedMessage; never \c Auto.
+        */
+        MessageReplay Save(std::vector<std::uint8_t>& buffer, MessageReplay replay = MessageReplay::Auto) const;
+
+        /**
+         * @brief Message ID.
+        */
+        [[nodiscard]] int MsgId() const
+        {
+            return msg_id_;
+        }
+
+        /**
+         * @brief Encoded message.
+        */
+        [[nodiscard]] const std::uint8_t* Data() const
+        {
+            return data_.data();
+        }
+
+        /**
+         * @brief Size of the encoded message, in bytes.
+        */
+        [[nodiscard]] std::size_t Size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Whether a write did not fit into \c MAX_MESSAGE_SIZE bytes.
+        */
+        [[nodiscard]] bool Overflowed() const
+        {
+            return overflowed_;
+        }
+
+    private:
+        /**
+         * @brief Logs an error if the message overflowed.
+         *
+         * @return \c true if the message can be sent.
+        */
+        bool CheckOverflow() const;
+
+        struct Field
+        {
+            std::uint16_t offset{};
+            MessageField type{};
+
+            /**
+             * @brief Original value of an integer field; the encoded bytes may hold a truncated value.
+            */
+            int int_value{};
+
+            /**
+             * @brief Original value of an angle or a coordinate.
+            */
+            float float_value{};
+        };
+
+        FORCEINLINE bool AddField(const MessageField type, const std::size_t size, const int int_value,
+                                  const float float_value)
+        {
+            if (overflowed_ || size_ + size > MAX_MESSAGE_SIZE) {
+                overflowed_ = true;
+                return false;
+            }
+
+            fields_[field_count_++] = Field{static_cast<std::uint16_t>(size_), type, int_value, float_value};
+            return true;
+        }
+
+        FORCEINLINE void Put(const int value, const std::size_t size)
+        {
+            const auto bits = static_cast<std::uint32_t>(value);
+
+            for (std::size_t i = 0; i < size; ++i) {
+                data_[size_++] = static_cast<std::uint8_t>(bits >> (i * 8));
+            }
+        }
+
+        int msg_id_{};
+        std::size_t size_{};
+        std::size_t field_count_{};
+        bool overflowed_{};
+        std::array<std::uint8_t, MAX_MESSAGE_SIZE> data_{};
+
+        /**
+         * @brief Every field takes at least one byte.
+        */
+        std::array<Field, MAX_MESSAGE_SIZE> fields_{};
+    };
+}
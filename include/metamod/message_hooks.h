@@ -0,0 +1,249 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/message_builder.h>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Maximum total length of the strings of an intercepted message, including rewritten strings.
+    */
+    constexpr std::size_t MAX_MESSAGE_STRINGS_SIZE = 2048;
+
+    /**
+     * @brief Outgoing network message captured before it reached the engine.
+     *
+     * Message handlers can read and rewrite its fields and destination, or block it.
+     * The message is only valid during the call of the handlers.
+    */
+    class InterceptedMessage
+    {
+    public:
+        /**
+         * @brief Message type.
+        */
+        [[nodiscard]] cssdk::MessageType Type() const
+        {
+            return msg_type_;
+        }
+
+        /**
+         * @brief Message ID.
+        */
+        [[nodiscard]] int Id() const
+        {
+            return msg_id_;
+        }
+
+        /**
+         * @brief Origin used for PVS and PAS checks, or \c nullptr.
+        */
+        [[nodiscard]] const float* Origin() const
+        {
+            return has_origin_ ? origin_.data() : nullptr;
+        }
+
+        /**
+         * @brief Client the message is sent to, if it's a message to one client.
+        */
+        [[nodiscard]] cssdk::Edict* Client() const
+        {
+            return client_;
+        }
+
+        /**
+         * @brief Changes the destination of the message.
+        */
+        void SetDestination(const cssdk::MessageType msg_type, cssdk::Edict* const client)
+        {
+            msg_type_ = msg_type;
+            client_ = client;
+        }
+
+        /**
+         * @brief Number of fields.
+        */
+        [[nodiscard]] std::size_t Count() const
+        {
+            return count_;
+        }
+
+        /**
+         * @brief Type of the field.
+        */
+        [[nodiscard]] MessageField FieldType(const std::size_t index) const
+        {
+            return fields_[index].type;
+        }
+
+        /**
+         * @brief Value of a byte, char, short, long or entity field.
+        */
+        [[nodiscard]] int GetInt(const std::size_t index) const
+        {
+            return fields_[index].int_value;
+        }
+
+        /**
+         * @brief Value of an angle or coord field.
+        */
+        [[nodiscard]] float GetFloat(const std::size_t index) const
+        {
+            return fields_[index].float_value;
+        }
+
+        /**
+         * @brief Value of a string field.
+        */
+        [[nodiscard]] const char* GetString(const std::size_t index) const
+        {
+            return fields_[index].string_value;
+        }
+
+        /**
+         * @brief Changes the value of a byte, char, short, long or entity field.
+        */
+        void SetInt(const std::size_t index, const int value)
+        {
+            fields_[index].int_value = value;
+        }
+
+        /**
+         * @brief Changes the value of an angle or coord field.
+        */
+        void SetFloat(const std::size_t index, const float value)
+        {
+            fields_[index].float_value = value;
+        }
+
+        /**
+         * @brief Changes the value of a string field; the string is copied.
+         *
+         * @return \c false if there is no room left for the string; the field is not changed.
+        */
+        bool SetString(std::size_t index, const char* value);
+
+        /**
+         * @brief Whether all fields have the given types, in order.
+        */
+        template <MessageField... Types>
+        [[nodiscard]] bool Matches() const
+        {
+            std::size_t index = 0;
+            return count_ == sizeof...(Types) && ((fields_[index++].type == Types) && ...);
+        }
+
+        /**
+         * @brief Prevents the message from being sent.
+        */
+        void Block()
+        {
+            blocked_ = true;
+        }
+
+        /**
+         * @brief Whether the message was blocked by a handler.
+        */
+        [[nodiscard]] bool Blocked() const
+        {
+            return blocked_;
+        }
+
+        /**
+         * @brief Starts capturing a new message; used by the interception hooks.
+        */
+        void Begin(cssdk::MessageType msg_type, int msg_id, const float* origin, cssdk::Edict* client);
+
+        /**
+         * @brief Appends a field; used by the interception hooks.
+         *
+         * @return \c false if the message has too many fields or strings.
+        */
+        bool Add(MessageField type, int int_value, float float_value, const char* string_value);
+
+        /**
+         * @brief Sends the message to the engine; used by the interception hooks.
+        */
+        void Send() const;
+
+        /**
+         * @brief Begins the message and writes its fields to the engine without ending it;
+         * used by the interception hooks to pass through a message that is too long to be captured.
+        */
+        void Forward() const;
+
+    private:
+        struct Field
+        {
+            MessageField type{};
+            int int_value{};
+            float float_value{};
+            const char* string_value{};
+        };
+
+        const char* CopyString(const char* value);
+
+        cssdk::MessageType msg_type_{};
+        int msg_id_{};
+        bool has_origin_{};
+        std::array<float, 3> origin_{};
+        cssdk::Edict* client_{};
+        bool blocked_{};
+        std::size_t count_{};
+        std::array<Field, MAX_MESSAGE_SIZE> fields_{};
+        std::size_t strings_size_{};
+        std::array<char, MAX_MESSAGE_STRINGS_SIZE> strings_{};
+    };
+
+    /**
+     * @brief Message handler; may rewrite or block the message.
+    */
+    using MessageHandler = std::add_pointer_t<void(InterceptedMessage& message)>;
+
+    /**
+     * @brief Intercepts the outgoing messages with the given ID.
+     *
+     * A message with handlers is captured by the \c MessageBegin, \c Write* and \c MessageEnd engine hooks of
+     * this plugin instead of reaching the engine. At \c MessageEnd the handlers are called in priority order
+     * with the decoded message, and the message is then sent, with the changes of the handlers, unless it was
+     * blocked. Messages without handlers pass through without being captured, and a message with more fields
+     * or longer strings than can be captured is sent unchanged, without calling the handlers.
+     *
+     * Messages sent by a handler, and messages sent by this plugin while replaying, are not intercepted.
+     *
+     * @param msg_id Message ID (0 to 255).
+     * @param handler The handler function pointer to add or \c nullptr to remove all handlers of this message.
+     * @param priority Handlers of this message with a higher priority are called first.
+    */
+    void HookMessage(int msg_id, MessageHandler handler, int priority = 0);
+
+    /**
+     * @brief Removes a handler of the messages with the given ID.
+    */
+    void UnhookMessage(int msg_id, MessageHandler handler);
+
+    /**
+     * @brief Whether the messages with the given ID have handlers.
+    */
+    bool IsMessageHooked(int msg_id);
+}
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/message_builder.h>
+#include <cstddef>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Default number of bytes per client and frame sent from the deferred message queue.
+    */
+    constexpr std::size_t DEFAULT_MESSAGE_BUDGET = 1024;
+
+    /**
+     * @brief Queues a non-critical message to be sent within the per-client bandwidth budget.
+     *
+     * At every \c StartFrame each client's queue is drained in priority order (first in, first out among equal
+     * priorities) until the client's budget for the frame is used up; a message larger than the budget is
+     * sent alone. Queues of clients that disconnect are dropped, and all queues are dropped when the map ends.
+     *
+     * @param message Message to send; its fields are copied.
+     * @param client Client to send the message to, or \c nullptr to queue it for every connected client.
+     * @param priority Messages with a higher priority are sent first.
+     * @param reliable Whether the message is sent reliably.
+     * @param replay How the message is written to the engine.
+    */
+    void QueueMessage(const MessageBuilder& message, cssdk::Edict* client, int priority = 0, bool reliable = true,
+                      MessageReplay replay = MessageReplay::Auto);
+
+    /**
+     * @brief Sets the number of bytes per client and frame sent from the deferred message queue.
+    */
+    void SetMessageBudget(std::size_t bytes_per_frame);
+
+    /**
+     * @brief Number of messages queued for the client.
+    */
+    std::size_t QueuedMessages(int client_index);
+}
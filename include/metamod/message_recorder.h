@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Magic number at the start of a message recording ("MMRC" in little-endian).
+    */
+    constexpr std::uint32_t MESSAGE_RECORDING_MAGIC = 0x43524D4D;
+
+    /**
+     * @brief Version of the message recording format.
+    */
+    constexpr std::uint32_t MESSAGE_RECORDING_VERSION = 1;
+
+    /**
+     * @brief Header at the start of a message recording.
+    */
+    struct MessageRecordingHeader
+    {
+        std::uint32_t magic{MESSAGE_RECORDING_MAGIC};
+        std::uint32_t version{MESSAGE_RECORDING_VERSION};
+
+        /**
+         * @brief Size of this header; the first record starts at this offset.
+        */
+        std::uint32_t header_size{sizeof(MessageRecordingHeader)};
+
+        std::uint32_t reserved{};
+    };
+
+    /**
+     * @brief Header of a recorded message.
+     *
+     * A recording is a \c MessageRecordingHeader followed by records, each a \c MessageRecordHeader followed by
+     * \c field_count fields and padded to a multiple of 4 bytes, so the file can be mapped into memory and walked
+     * record by record. A field is one \c MessageField byte followed by its value: 1 byte for byte, char;
+     * 2 bytes for short, entity; 4 bytes for long; a 4-byte float for angle, coord; the null terminated
+     * characters for string. Values are little-endian and not aligned.
+    */
+    struct MessageRecordHeader
+    {
+        /**
+         * @brief Size of the record including this header and the padding.
+        */
+        std::uint32_t size{};
+
+        /**
+         * @brief Number of the frame since the recording started.
+        */
+        std::uint32_t frame{};
+
+        /**
+         * @brief Server time.
+        */
+        float time{};
+
+        std::int16_t msg_id{};
+        std::uint8_t msg_type{};
+        std::uint8_t has_origin{};
+
+        /**
+         * @brief Entity index of the client, or -1.
+        */
+        std::int16_t client{};
+
+        std::uint16_t field_count{};
+        float origin[3]{};
+    };
+
+    static_assert(sizeof(MessageRecordingHeader) == 16 && sizeof(MessageRecordHeader) == 32,
+                  "The recording format must not depend on the compiler.");
+
+    /**
+     * @brief Starts streaming every outgoing network message to a binary file.
+     *
+     * Messages are recorded by engine pre hooks with the lowest priority into in-memory buffers, which are
+     * handed to a background thread at every \c StartFrame and appended to the file, so the game thread never
+     * waits for the disk. If the writer falls behind by more than a few megabytes, records are dropped and
+     * the number of dropped records is logged when the recording stops.
+     *
+     * @param path Path of the file; an existing file is overwritten.
+     *
+     * @return \c true if the recording started.
+    */
+    bool StartMessageRecorder(const char* path);
+
+    /**
+     * @brief Stops the recording, writes the remaining records and closes the file.
+     * Called automatically when the plugin is unloaded.
+    */
+    void StopMessageRecorder();
+}
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <metamod/engine.h>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace metamod::engine
+{
+    /**
+     * @brief Set of clients; bit \c N is the client with the entity index \c N + 1.
+    */
+    using ClientMask = std::uint64_t;
+
+    /**
+     * @brief Returns the mask bit of the client with the given entity index (1 to 64).
+    */
+    constexpr ClientMask ClientBit(const int client_index)
+    {
+        return ClientMask{1} << (client_index - 1);
+    }
+
+    /**
+     * @brief Returns the mask of the clients that can receive network messages (connected players, excluding bots).
+     * It is built from the player roster (see \c gamedll::Roster), not from a scan of the client slots.
+    */
+    ClientMask ReceivingClients();
+
+    /**
+     * @brief Returns the entity index of the lowest client in a non-empty mask.
+    */
+    FORCEINLINE int LowestClient(const ClientMask clients)
+    {
+#ifdef _MSC_VER
+        unsigned long bit{};
+        _BitScanForward64(&bit, clients);
+        return static_cast<int>(bit) + 1;
+#else
+        return __builtin_ctzll(clients) + 1;
+#endif
+    }
+
+    /**
+     * @brief Sends a network message to a set of clients using the cheapest message type.
+     *
+     * If \c clients covers every client that can receive messages, the message is sent once as \c All
+     * (or \c Broadcast if unreliable); otherwise it is sent to each client as \c One (or \c OneUnreliable).
+     * Clients that cannot receive messages are skipped.
+     *
+     * @code
+     * metamod::engine::MessageMulticast(team_mask, msg_id, true, [&] {
+     *     metamod::engine::WriteByte(score);
+     * });
+     * @endcode
+     *
+     * @param clients Clients to send the message to.
+     * @param msg_id Message ID.
+     * @param reliable Whether the message is sent reliably.
+     * @param write Writes the fields of the message; called once per sent message.
+    */
+    template <typename TWrite>
+    void MessageMulticast(ClientMask clients, const int msg_id, const bool reliable, TWrite&& write)
+    {
+        const auto receiving = ReceivingClients();
+        clients &= receiving;
+
+        if (clients == 0) {
+            return;
+        }
+
+        if (clients == receiving) {
+            MessageBegin(reliable ? cssdk::MessageType::All : cssdk::MessageType::Broadcast, msg_id);
+            write();
+            MessageEnd();
+            return;
+        }
+
+        const auto msg_type = reliable ? cssdk::MessageType::One : cssdk::MessageType::OneUnreliable;
+
+        for (; clients != 0; clients &= clients - 1) {
+            MessageBegin(msg_type, msg_id, nullptr, EntityOfEntIndex(LowestClient(clients)));
+            write();
+            MessageEnd();
+        }
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <cstdint>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Kind of a cached name lookup.
+    */
+    enum class NameKind : std::uint8_t
+    {
+        /**
+         * @brief \c ModelIndex
+        */
+        Model,
+
+        /**
+         * @brief \c DecalIndex
+        */
+        Decal,
+
+        /**
+         * @brief \c FunctionFromName
+        */
+        Function,
+
+        /**
+         * @brief \c utils::GetUserMsgId
+        */
+        UserMessage,
+
+        /**
+         * @brief \c PrecacheEvent (type 1)
+        */
+        Event
+    };
+}
+
+namespace metamod::engine::detail
+{
+    /**
+     * @brief Incremented on every \c ServerDeactivate; cached indices of an older generation are stale.
+    */
+    inline std::uint32_t name_cache_generation = 1;
+
+    /**
+     * @brief Looks up the name with the engine or Metamod function of the given kind.
+     *
+     * @return \c true if the name was found; failed lookups are not cached.
+    */
+    bool ResolveName(NameKind kind, const char* name, std::int64_t& index, int* size);
+
+    /**
+     * @brief Installs the hook that invalidates the cached indices on \c ServerDeactivate.
+    */
+    void InstallNameCacheHooks();
+}
+
+namespace metamod::engine
+{
+    /**
+     * @brief Index of a name that is looked up once per map.
+     *
+     * The first \c Get after a map change calls the engine; every other call is a compare and a load.
+     *
+     * @code
+     * static metamod::engine::CachedModel smoke_model{"sprites/steam1.spr"};
+     * builder.WriteShort(smoke_model.Get());
+     * @endcode
+    */
+    template <NameKind Kind, typename TIndex = int>
+    class CachedIndex
+    {
+    public:
+        /**
+         * @param name Name to look up; it must outlive this object.
+        */
+        explicit constexpr CachedIndex(const char* const name)
+            : name_(name)
+        {
+        }
+
+        /**
+         * @brief Returns the index of the name, or the failure value of the underlying function.
+        */
+        FORCEINLINE TIndex Get()
+        {
+            if (generation_ != detail::name_cache_generation) {
+                Resolve();
+            }
+
+            return index_;
+        }
+
+        /**
+         * @brief Returns the name.
+        */
+        [[nodiscard]] constexpr const char* Name() const
+        {
+            return name_;
+        }
+
+    private:
+        void Resolve()
+        {
+            std::int64_t index{};
+
+            const auto found = detail::ResolveName(Kind, name_, index, nullptr);
+            index_ = static_cast<TIndex>(index);
+
+            if (found) {
+                generation_ = detail::name_cache_generation;
+            }
+        }
+
+        const char* name_;
+        TIndex index_{};
+        std::uint32_t generation_{};
+    };
+
+    using CachedModel = CachedIndex<NameKind::Model>;
+    using CachedDecal = CachedIndex<NameKind::Decal>;
+    using CachedFunction = CachedIndex<NameKind::Function, cssdk::uint32>;
+    using CachedUserMessage = CachedIndex<NameKind::UserMessage>;
+    using CachedEvent = CachedIndex<NameKind::Event, unsigned short>;
+
+    /**
+     * @brief ID of a name interned with \c InternName.
+    */
+    using NameId = std::uint32_t;
+
+    /**
+     * @brief Interns a name that is not known at compile time, for the cached lookups by ID.
+     *
+     * Interning compares the name with the interned names, so it is done once, e.g. when the configuration
+     * is loaded; a lookup by ID is then an array index and a compare. Equal names get the same ID.
+     *
+     * @code
+     * const auto model = metamod::engine::InternName(config.model);
+     * builder.WriteShort(metamod::engine::CachedModelIndex(model));
+     * @endcode
+    */
+    NameId InternName(const char* name);
+
+    /**
+     * @brief \c ModelIndex of the interned name, looked up once per map.
+    */
+    int CachedModelIndex(NameId model);
+
+    /**
+     * @brief \c DecalIndex of the interned name, looked up once per map.
+    */
+    int CachedDecalIndex(NameId name);
+
+    /**
+     * @brief \c FunctionFromName of the interned name, looked up once per map.
+    */
+    cssdk::uint32 CachedFunctionFromName(NameId name);
+
+    /**
+     * @brief \c utils::GetUserMsgId of the interned name, looked up once per map.
+    */
+    int CachedUserMsgId(NameId name, int* size = nullptr);
+
+    /**
+     * @brief \c PrecacheEvent of type 1 of the interned path, looked up once per map.
+    */
+    unsigned short CachedPrecacheEvent(NameId path);
+}
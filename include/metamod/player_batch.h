@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cstddef>
+#include <type_traits>
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Batch callback: receives the players of a frame as a contiguous array.
+    */
+    using PlayerBatchCallback = std::add_pointer_t<void(cssdk::Edict* const* players, std::size_t count)>;
+
+    /**
+     * @brief Calls the callback once per frame with every player whose \c PlayerPreThink ran during that frame.
+     *
+     * Each player is recorded once per frame by a post hook of \c PlayerPreThink, in the order of the calls.
+     * The batch is delivered at the start of the next frame (before the \c StartFrame hooks of this plugin)
+     * or when the map ends, so batch callbacks cannot change the result of the individual calls.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all batch callbacks of this hook.
+    */
+    void HookPlayerPreThinkBatch(PlayerBatchCallback callback);
+
+    /**
+     * @brief Calls the callback once per frame with every player whose \c PlayerPostThink ran during that frame.
+     * Batches are collected and delivered like those of \c HookPlayerPreThinkBatch.
+     *
+     * @param callback The callback function pointer to add or \c nullptr to disable all batch callbacks of this hook.
+    */
+    void HookPlayerPostThinkBatch(PlayerBatchCallback callback);
+}
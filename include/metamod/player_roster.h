@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cssdk/public/os_defs.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Connection state of a player slot.
+    */
+    enum class PlayerState : std::uint8_t
+    {
+        /**
+         * @brief No client.
+        */
+        Free,
+
+        /**
+         * @brief The client was accepted by \c ClientConnect and is loading resources.
+        */
+        Connected,
+
+        /**
+         * @brief The client was put in the server.
+        */
+        InGame
+    };
+
+    /**
+     * @brief Life state selected by a \c PlayerFilter.
+    */
+    enum class PlayerLife : std::uint8_t
+    {
+        Any,
+
+        /**
+         * @brief \c dead_flag is \c DEAD_NO and the health is positive.
+        */
+        Alive,
+
+        Dead
+    };
+
+    /**
+     * @brief Selects players of the roster.
+    */
+    struct PlayerFilter
+    {
+        /**
+         * @brief Whether the players that are still connecting are included.
+        */
+        bool connecting{};
+
+        bool bots{true};
+        bool humans{true};
+
+        /**
+         * @brief \c EntityVars::team of the players, or 0 for any team.
+        */
+        int team{};
+
+        PlayerLife life{PlayerLife::Any};
+    };
+
+    /**
+     * @brief Player of the roster.
+    */
+    struct RosterPlayer
+    {
+        cssdk::Edict* edict{};
+
+        /**
+         * @brief Entity index; it does not change while the client is connected.
+        */
+        int index{};
+
+        PlayerState state{};
+    };
+}
+
+namespace metamod::gamedll::detail
+{
+    /**
+     * @brief Connected players, in no particular order.
+    */
+    inline std::vector<RosterPlayer> roster_players{};
+
+    /**
+     * @brief Position in \c roster_players by entity index.
+    */
+    inline std::vector<std::size_t> roster_positions{};
+
+    inline bool roster_started{};
+
+    /**
+     * @brief Installs the hooks that maintain the roster and adds the clients that are connected already.
+    */
+    void StartRoster();
+
+    FORCEINLINE bool MatchesPlayerFilter(const RosterPlayer& player, const PlayerFilter& filter)
+    {
+        if (player.state != PlayerState::InGame && !filter.connecting) {
+            return false;
+        }
+
+        const auto& vars = player.edict->vars;
+
+        if (!((vars.flags & cssdk::FL_FAKE_CLIENT) ? filter.bots : filter.humans)) {
+            return false;
+        }
+
+        if (filter.team != 0 && vars.team != filter.team) {
+            return false;
+        }
+
+        if (filter.life != PlayerLife::Any) {
+            const auto alive = vars.dead_flag == 0 && vars.health > 0.F;
+            return alive == (filter.life == PlayerLife::Alive);
+        }
+
+        return true;
+    }
+}
+
+namespace metamod::gamedll
+{
+    /**
+     * @brief Returns the connected players.
+     *
+     * The roster is maintained from the \c ClientConnect, \c ClientPutInServer and \c ClientDisconnect hooks
+     * and sized by the \c client_max of \c ServerActivate, so iterating it touches only the connected
+     * players and does not call the engine. Bots put in the server without the \c ClientPutInServer hook
+     * (by the game DLL or by other plugins) are added by a scan of the client slots on \c ServerActivate and
+     * on the frame after a \c CreateFakeClient call. It is built on the first call.
+    */
+    inline const std::vector<RosterPlayer>& Roster()
+    {
+        if (!detail::roster_started) {
+            detail::StartRoster();
+        }
+
+        return detail::roster_players;
+    }
+
+    /**
+     * @brief Calls \c callback with the \c cssdk::Edict* of every player accepted by the filter.
+     * The callback must not connect or disconnect clients.
+     *
+     * @code
+     * metamod::gamedll::ForEachPlayer({false, false, true, TEAM_CT, metamod::gamedll::PlayerLife::Alive},
+     *                                 [](cssdk::Edict* const player) { ... });
+     * @endcode
+    */
+    template <typename TCallback>
+    void ForEachPlayer(const PlayerFilter& filter, const TCallback& callback)
+    {
+        for (const auto& player : Roster()) {
+            if (detail::MatchesPlayerFilter(player, filter)) {
+                callback(player.edict);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of players accepted by the filter.
+    */
+    std::size_t CountPlayers(const PlayerFilter& filter = {});
+
+    /**
+     * @brief Returns the state of the player slot with the given entity index.
+    */
+    PlayerState GetPlayerState(int index);
+}
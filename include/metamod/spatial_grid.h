@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <cstddef>
+#include <vector>
+
+namespace metamod::engine
+{
+    /**
+     * @brief Edge length of a spatial grid cell.
+    */
+    constexpr float GRID_CELL_SIZE = 256.F;
+
+    /**
+     * @brief The grid covers [-GRID_WORLD_EXTENT, GRID_WORLD_EXTENT) on the X and Y axes;
+     * entities outside are kept in the border cells.
+    */
+    constexpr float GRID_WORLD_EXTENT = 8192.F;
+
+    /**
+     * @brief Number of cells on each axis.
+    */
+    constexpr int GRID_CELLS_PER_AXIS = static_cast<int>(2.F * GRID_WORLD_EXTENT / GRID_CELL_SIZE);
+
+    /**
+     * @brief A sphere of a batched query.
+    */
+    struct SphereQuery
+    {
+        cssdk::Vector origin{};
+        float radius{};
+    };
+
+    /**
+     * @brief Finds the entities whose absolute bounds are within \c radius of \c origin, like \c FindEntityInSphere.
+     *
+     * Entities are kept in a uniform grid on the X and Y axes by the center of their bounds. The grid is
+     * updated from the \c SetOrigin and \c SetSize post hooks. At every \c StartFrame it indexes the entities
+     * created or spawned since the previous frame and moves the entities with a move type other than
+     * \c MoveTypeEntity::None, which the physics moves without those calls; the other entity slots are not visited.
+     * A query visits only the cells overlapping the sphere plus a margin for the size of the entities and the
+     * distance they can have moved since then. It is built on the first query.
+     *
+     * Like \c FindEntityInSphere, free entities and entities without a class name are not returned.
+     *
+     * @param origin Center of the sphere.
+     * @param radius Radius of the sphere.
+     * @param result Receives the entities, in no particular order; it is cleared first.
+     *
+     * @return Number of entities found.
+    */
+    std::size_t FindEntitiesInSphere(const cssdk::Vector& origin, float radius, std::vector<cssdk::Edict*>& result);
+
+    /**
+     * @brief Finds the entities whose absolute bounds intersect the given box.
+     *
+     * @param min Minimum corner of the box.
+     * @param max Maximum corner of the box.
+     * @param result Receives the entities, in no particular order; it is cleared first.
+     *
+     * @return Number of entities found.
+    */
+    std::size_t FindEntitiesInBox(const cssdk::Vector& min, const cssdk::Vector& max, std::vector<cssdk::Edict*>& result);
+
+    /**
+     * @brief Runs several sphere queries at once.
+     *
+     * @param queries Spheres to query.
+     * @param count Number of spheres.
+     * @param result Receives the entities of all queries, one query after another; it is cleared first.
+     * @param offsets Receives <tt>count + 1</tt> offsets: the entities of query \c N are
+     * <tt>result[offsets[N]]</tt> to <tt>result[offsets[N + 1] - 1]</tt>.
+    */
+    void FindEntitiesInSpheres(const SphereQuery* queries, std::size_t count, std::vector<cssdk::Edict*>& result,
+                               std::vector<std::size_t>& offsets);
+}
@@ -0,0 +1,372 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cssdk/engine/eiface.h>
+#include <metamod/engine.h>
+#include <metamod/message_builder.h>
+#include <metamod/multicast.h>
+#include <metamod/utils.h>
+#include <type_traits>
+
+namespace metamod::engine::field
+{
+    /**
+     * @brief Single unsigned byte.
+    */
+    struct Byte
+    {
+        using Type = int;
+        static constexpr int SIZE = 1;
+
+        static void Write(const Type value)
+        {
+            WriteByte(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteByte(value);
+        }
+    };
+
+    /**
+     * @brief Single character.
+    */
+    struct Char
+    {
+        using Type = int;
+        static constexpr int SIZE = 1;
+
+        static void Write(const Type value)
+        {
+            WriteChar(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteChar(value);
+        }
+    };
+
+    /**
+     * @brief Single unsigned short.
+    */
+    struct Short
+    {
+        using Type = int;
+        static constexpr int SIZE = 2;
+
+        static void Write(const Type value)
+        {
+            WriteShort(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteShort(value);
+        }
+    };
+
+    /**
+     * @brief Single unsigned int.
+    */
+    struct Long
+    {
+        using Type = int;
+        static constexpr int SIZE = 4;
+
+        static void Write(const Type value)
+        {
+            WriteLong(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteLong(value);
+        }
+    };
+
+    /**
+     * @brief Single angle value.
+    */
+    struct Angle
+    {
+        using Type = float;
+        static constexpr int SIZE = 1;
+
+        static void Write(const Type value)
+        {
+            WriteAngle(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteAngle(value);
+        }
+    };
+
+    /**
+     * @brief Single coordinate value.
+    */
+    struct Coord
+    {
+        using Type = float;
+        static constexpr int SIZE = 2;
+
+        static void Write(const Type value)
+        {
+            WriteCoord(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteCoord(value);
+        }
+    };
+
+    /**
+     * @brief Coordinates (x, y, z).
+    */
+    struct Vector
+    {
+        using Type = const cssdk::Vector&;
+        static constexpr int SIZE = 6;
+
+        static void Write(const Type value)
+        {
+            WriteCoord(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteCoord(value);
+        }
+    };
+
+    /**
+     * @brief Single null terminated string; makes the message variable length.
+    */
+    struct String
+    {
+        using Type = const char*;
+        static constexpr int SIZE = -1;
+
+        static void Write(const Type value)
+        {
+            WriteString(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteString(value);
+        }
+    };
+
+    /**
+     * @brief Single entity index.
+    */
+    struct Entity
+    {
+        using Type = int;
+        static constexpr int SIZE = 2;
+
+        static void Write(const Type value)
+        {
+            WriteEntity(value);
+        }
+
+        static void Encode(MessageBuilder& builder, const Type value)
+        {
+            builder.WriteEntity(value);
+        }
+    };
+}
+
+namespace metamod::engine::detail
+{
+    /**
+     * @brief Whether \c TValue is the value type of the field \c TField itself, not a type converted to it.
+    */
+    template <typename TField, typename TValue>
+    constexpr bool IS_FIELD_VALUE = std::is_same_v<std::decay_t<TValue>, std::decay_t<typename TField::Type>> ||
+                                    (std::is_same_v<typename TField::Type, const char*> &&
+                                     std::is_same_v<std::decay_t<TValue>, char*>);
+}
+
+namespace metamod::engine
+{
+    /**
+     * @brief User message with a field layout declared at compile time.
+     *
+     * The send functions take exactly one argument of the field's own type per field (\c int for the integer
+     * fields, \c float for angles and coordinates), so a write of the wrong layout or a value that would be
+     * converted implicitly (e.g. a \c float for a byte) does not compile, and the fields are written without
+     * any runtime branching.
+     *
+     * @code
+     * namespace field = metamod::engine::field;
+     * using ScoreInfo = metamod::engine::UserMessage<field::Byte, field::Short, field::Short, field::Short, field::Short>;
+     *
+     * ScoreInfo score_info{};
+     * score_info.Find("ScoreInfo");
+     * score_info.Send(cssdk::MessageType::All, nullptr, index, frags, deaths, class_id, team);
+     * @endcode
+     *
+     * @tparam TFields Fields of the message, in order (see the \c metamod::engine::field namespace).
+    */
+    template <typename... TFields>
+    class UserMessage
+    {
+    public:
+        /**
+         * @brief Size of the message, in bytes, or -1 if it has variable length.
+        */
+        static constexpr int SIZE = ((TFields::SIZE >= 0) && ...) ? (0 + ... + TFields::SIZE) : -1;
+
+        static_assert(SIZE <= static_cast<int>(MAX_MESSAGE_SIZE), "User messages are limited to 192 bytes.");
+
+        UserMessage() = default;
+
+        /**
+         * @brief Registers the message with the engine.
+         *
+         * @return \c true if the message was registered.
+        */
+        bool Register(const char* const name)
+        {
+            msg_id_ = RegUserMessage(name, SIZE);
+            return msg_id_ > 0;
+        }
+
+        /**
+         * @brief Finds the message registered by the game DLL and checks that its size matches the layout.
+         *
+         * @return \c true if the message was found and its size matches; a mismatch is logged.
+        */
+        bool Find(const char* const name)
+        {
+            int size{};
+            msg_id_ = utils::GetUserMsgId(name, &size);
+
+            if (msg_id_ <= 0) {
+                msg_id_ = 0;
+                AlertMessage(cssdk::AlertType::Logged, "User message: %s is not registered.\n", name);
+                return false;
+            }
+
+            if (size != SIZE) {
+                AlertMessage(cssdk::AlertType::Logged, "User message: %s size mismatch; registered = %d; declared = %d.\n",
+                             name, size, SIZE);
+                msg_id_ = 0;
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Message ID, or 0 if the message was not registered or found.
+        */
+        [[nodiscard]] int Id() const
+        {
+            return msg_id_;
+        }
+
+        /**
+         * @brief Sends the message.
+         *
+         * @param msg_type Message type.
+         * @param client If it's a message to one client, client to send the message to.
+         * @param values Field values.
+         *
+         * @note A message that was not registered or found is not sent; the error is logged.
+        */
+        template <typename... TValues>
+        void Send(const cssdk::MessageType msg_type, cssdk::Edict* const client, const TValues&... values) const
+        {
+            CheckValues<TValues...>();
+
+            if (!CheckId()) {
+                return;
+            }
+
+            MessageBegin(msg_type, msg_id_, nullptr, client);
+            (TFields::Write(values), ...);
+            MessageEnd();
+        }
+
+        /**
+         * @brief Sends the message to a set of clients using the cheapest message type (see \c MessageMulticast).
+        */
+        template <typename... TValues>
+        void Send(const ClientMask clients, const bool reliable, const TValues&... values) const
+        {
+            CheckValues<TValues...>();
+
+            if (!CheckId()) {
+                return;
+            }
+
+            MessageMulticast(clients, msg_id_, reliable, [&] {
+                (TFields::Write(values), ...);
+            });
+        }
+
+        /**
+         * @brief Encodes the message into \c builder, which can then be sent to any number of recipients.
+        */
+        template <typename... TValues>
+        void Encode(MessageBuilder& builder, const TValues&... values) const
+        {
+            CheckValues<TValues...>();
+
+            builder.Reset(msg_id_);
+            (TFields::Encode(builder, values), ...);
+        }
+
+    private:
+        template <typename... TValues>
+        static constexpr void CheckValues()
+        {
+            static_assert(sizeof...(TValues) == sizeof...(TFields), "One value per field of the message is required.");
+
+            if constexpr (sizeof...(TValues) == sizeof...(TFields)) {
+                static_assert((detail::IS_FIELD_VALUE<TFields, TValues> && ...),
+                              "The type of a value does not match the type of its field.");
+            }
+        }
+
+        /**
+         * @brief Logs an error if the message was not registered or found; message ID 0 is \c svc_bad.
+         *
+         * @return \c true if the message can be sent.
+        */
+        [[nodiscard]] bool CheckId() const
+        {
+            if (msg_id_ <= 0) {
+                AlertMessage(cssdk::AlertType::Logged, "User message: the message is not registered and was not sent.\n");
+                return false;
+            }
+
+            return true;
+        }
+
+        int msg_id_{};
+    };
+}
@@ -18,8 +18,13 @@
 #include <metamod/api.h>
 #include <cssdk/engine/eiface.h>
 #include <cssdk/public/os_defs.h>
+#include <metamod/engine.h>
 #include <metamod/engine_hooks.h>
 #include <metamod/gamedll_hooks.h>
+#include <metamod/hook_profiler.h>
+#include <metamod/hook_table.h>
+#include <metamod/message_recorder.h>
+#include <metamod/name_cache.h>
 #include <metamod/utils.h>
 #include <cstring>
 #include <type_traits>
@@ -32,6 +37,7 @@ using namespace gamedll;
 using namespace utils::detail;
 using namespace engine::detail;
 using namespace gamedll::detail;
+using namespace metamod::detail;
 
 namespace metamod::engine::detail
 {
@@ -71,25 +77,53 @@ namespace
         DllNewFunctions* dllnew_funcs_table{};
     };
 
-    void FreeAllHookTables()
+    void ClearAllHookTables()
     {
-        delete engine_hooks;
-        engine_hooks = nullptr;
+        ClearEngineHooks(true);
+        ClearGameDllHooks(true);
+    }
+
+#ifdef META_SKIP_EMPTY_HOOK_TABLES
+    /**
+     * @brief Does not export the tables that have no hooks installed,
+     * so Metamod does not include this plugin when it dispatches their functions.
+    */
+    void SkipEmptyHookTables(ExportHooksFuncs* const export_hooks_funcs)
+    {
+        if ((dll_hooks_skipped = IsHookTableEmpty(*dll_hooks))) {
+            export_hooks_funcs->export_dll_hooks = nullptr;
+        }
+
+        if ((dll_post_hooks_skipped = IsHookTableEmpty(*dll_post_hooks))) {
+            export_hooks_funcs->export_dll_post_hooks = nullptr;
+        }
 
-        delete engine_post_hooks;
-        engine_post_hooks = nullptr;
+        if ((dll_new_hooks_skipped = IsHookTableEmpty(*dll_new_hooks))) {
+            export_hooks_funcs->export_dllnew_hooks = nullptr;
+        }
 
-        delete dll_hooks;
-        dll_hooks = nullptr;
+        if ((dll_new_post_hooks_skipped = IsHookTableEmpty(*dll_new_post_hooks))) {
+            export_hooks_funcs->export_dllnew_post_hooks = nullptr;
+        }
 
-        delete dll_post_hooks;
-        dll_post_hooks = nullptr;
+        if ((engine_hooks_skipped = IsHookTableEmpty(*engine_hooks))) {
+            export_hooks_funcs->export_engine_hooks = nullptr;
+        }
 
-        delete dll_new_hooks;
-        dll_new_hooks = nullptr;
+        if ((engine_post_hooks_skipped = IsHookTableEmpty(*engine_post_hooks))) {
+            export_hooks_funcs->export_engine_post_hooks = nullptr;
+        }
+    }
+#endif
+}
 
-        delete dll_new_post_hooks;
-        dll_new_post_hooks = nullptr;
+namespace metamod::detail
+{
+    void ReportSkippedHookTable(const char* const table_name)
+    {
+        AlertMessage(AlertType::Logged, "[%s] Hooks changed in %s, which were empty at attach time and not exported; "
+                                        "the change takes effect after the plugin is reloaded.\n",
+                     PLUGIN_LOG_TAG, table_name);
     }
 }
 
@@ -112,7 +146,7 @@ extern "C" Status DLLEXPORT Meta_Query(const char* const interface_version, Plug
                                        const Funcs* const util_funcs)
 {
     if (std::strcmp(interface_version, metamod::INTERFACE_VERSION) != 0) {
-        FreeAllHookTables();
+        ClearAllHookTables();
         return Status::Failed;
     }
 
@@ -157,7 +191,7 @@ extern "C" Status DLLEXPORT Meta_Attach(const PluginLoadTime /*load_time*/, Expo
 
 #ifdef META_ATTACH
     if (META_ATTACH() != Status::Ok) {
-        FreeAllHookTables();
+        ClearAllHookTables();
 
         export_hooks_funcs->not_used1 = export_hooks_funcs->not_used2 = nullptr;
         export_hooks_funcs->export_dll_hooks = export_hooks_funcs->export_dll_post_hooks = nullptr;
@@ -168,6 +202,16 @@ extern "C" Status DLLEXPORT Meta_Attach(const PluginLoadTime /*load_time*/, Expo
     }
 #endif
 
+#ifdef META_SKIP_EMPTY_HOOK_TABLES
+    // The cached names must be invalidated on every map change, even if the name cache is first used later.
+    InstallNameCacheHooks();
+    SkipEmptyHookTables(export_hooks_funcs);
+#endif
+
+#ifdef META_HOOK_PROFILER
+    AddServerCommand(META_HOOK_PROFILER, &DumpHookProfiles);
+#endif
+
     return Status::Ok;
 }
 
@@ -178,8 +222,11 @@ extern "C" Status DLLEXPORT Meta_Detach(const PluginLoadTime /*now*/, const Plug
     META_DETACH();
 #endif
 
-    ClearEngineHooks();
-    ClearGameDllHooks();
+    // Completes the recording file while the writer thread can still be joined.
+    StopMessageRecorder();
+
+    ClearEngineHooks(true);
+    ClearGameDllHooks(true);
 
     return Status::Ok;
 }
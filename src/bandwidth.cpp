@@ -0,0 +1,405 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/bandwidth.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <metamod/multicast.h>
+#include <metamod/utils.h>
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    /**
+     * @brief Statistics of one frame.
+    */
+    struct FrameStats
+    {
+        std::uint32_t bytes{};
+        std::uint32_t count{};
+    };
+
+    /**
+     * @brief Statistics over the last \c BANDWIDTH_WINDOW_FRAMES frames.
+    */
+    struct Window
+    {
+        std::array<FrameStats, BANDWIDTH_WINDOW_FRAMES> frames{};
+        MessageStats sum{};
+
+        void Add(const std::size_t frame, const std::uint32_t bytes)
+        {
+            auto& stats = frames[frame];
+            stats.bytes += bytes;
+            ++stats.count;
+            sum.bytes += bytes;
+            ++sum.count;
+        }
+
+        /**
+         * @brief Drops the oldest frame, whose slot is reused for the new frame.
+        */
+        void Advance(const std::size_t frame)
+        {
+            auto& stats = frames[frame];
+            sum.bytes -= stats.bytes;
+            sum.count -= stats.count;
+            stats = {};
+        }
+    };
+
+    struct BandwidthAccounting
+    {
+        std::array<std::array<MessageStats, MAX_MESSAGE_IDS>, MAX_ACCOUNTED_CLIENTS> totals{};
+        std::array<MessageStats, MAX_ACCOUNTED_CLIENTS> client_totals{};
+        std::array<MessageStats, MAX_MESSAGE_IDS> message_totals{};
+        std::array<Window, MAX_ACCOUNTED_CLIENTS> client_windows{};
+        std::array<Window, MAX_MESSAGE_IDS> message_windows{};
+        MessageStats frame{};
+
+        /**
+         * @brief Slot of the current frame in the windows.
+        */
+        std::size_t window_frame{};
+
+        /**
+         * @brief Clients that received the messages to all clients during the current frame.
+        */
+        ClientMask receiving_clients{};
+    };
+
+    BandwidthAccounting accounting{};
+
+    bool accounting_enabled{};
+    bool dump_command_added{};
+
+    bool tracking{};
+    MessageType message_type{};
+    int message_id{};
+    Edict* message_client{};
+    std::uint32_t message_size{};
+
+    void Account(const int client_index, const int msg_id, const std::uint32_t bytes)
+    {
+        auto& total = accounting.totals[client_index][msg_id];
+        total.bytes += bytes;
+        ++total.count;
+
+        auto& client_total = accounting.client_totals[client_index];
+        client_total.bytes += bytes;
+        ++client_total.count;
+
+        accounting.client_windows[client_index].Add(accounting.window_frame, bytes);
+    }
+
+    void OnMessageBegin(const MessageType msg_type, const int msg_id, const float* /*origin*/, Edict* const client)
+    {
+        tracking = msg_id >= 0 && static_cast<std::size_t>(msg_id) < MAX_MESSAGE_IDS;
+        message_type = msg_type;
+        message_id = msg_id;
+        message_client = client;
+        message_size = 1;
+
+        SetResult(Result::Ignored);
+    }
+
+    FORCEINLINE void Count(const std::uint32_t size)
+    {
+        message_size += size;
+        SetResult(Result::Ignored);
+    }
+
+    void OnWriteByte(int /*value*/)
+    {
+        Count(1);
+    }
+
+    void OnWriteShort(int /*value*/)
+    {
+        Count(2);
+    }
+
+    void OnWriteLong(int /*value*/)
+    {
+        Count(4);
+    }
+
+    void OnWriteAngle(float /*value*/)
+    {
+        Count(1);
+    }
+
+    void OnWriteCoord(float /*value*/)
+    {
+        Count(2);
+    }
+
+    void OnWriteString(const char* const value)
+    {
+        Count(static_cast<std::uint32_t>(value != nullptr ? std::strlen(value) : 0) + 1);
+    }
+
+    void OnMessageEnd()
+    {
+        SetResult(Result::Ignored);
+
+        if (!tracking) {
+            return;
+        }
+
+        tracking = false;
+
+        accounting.frame.bytes += message_size;
+        ++accounting.frame.count;
+        accounting.message_totals[message_id].bytes += message_size;
+        ++accounting.message_totals[message_id].count;
+        accounting.message_windows[message_id].Add(accounting.window_frame, message_size);
+
+        switch (message_type) {
+        case MessageType::One:
+        case MessageType::OneUnreliable: {
+            const auto index = message_client != nullptr ? IndexOfEdict(message_client) : 0;
+            Account(index > 0 && static_cast<std::size_t>(index) < MAX_ACCOUNTED_CLIENTS ? index : 0, message_id, message_size);
+            break;
+        }
+
+        case MessageType::All:
+        case MessageType::Broadcast:
+        case MessageType::Spec:
+            for (auto clients = accounting.receiving_clients; clients != 0; clients &= clients - 1) {
+                Account(LowestClient(clients), message_id, message_size);
+            }
+            break;
+
+        default:
+            Account(0, message_id, message_size);
+            break;
+        }
+    }
+
+    void OnStartFrame()
+    {
+        accounting.window_frame = (accounting.window_frame + 1) % BANDWIDTH_WINDOW_FRAMES;
+
+        for (auto& window : accounting.client_windows) {
+            window.Advance(accounting.window_frame);
+        }
+
+        for (auto& window : accounting.message_windows) {
+            window.Advance(accounting.window_frame);
+        }
+
+        accounting.frame = {};
+        accounting.receiving_clients = ReceivingClients();
+
+        SetResult(Result::Ignored);
+    }
+
+    const char* MessageName(const int msg_id)
+    {
+        const auto* const name = utils::GetUserMsgName(msg_id);
+        return name != nullptr ? name : "(engine)";
+    }
+
+    void DumpBandwidth()
+    {
+        std::size_t count = 10;
+
+        for (auto i = 1; i < CmdArgc(); ++i) {
+            if (const auto* const arg = CmdArgv(i); std::strcmp(arg, "reset") == 0) {
+                ResetBandwidthAccounting();
+                ServerPrint("Bandwidth statistics reset.\n");
+                return;
+            }
+            else if (const auto value = std::atoi(arg); value > 0) {
+                count = static_cast<std::size_t>(value);
+            }
+        }
+
+        char line[256];
+        std::vector<int> ids{};
+
+        for (auto msg_id = 0; msg_id < static_cast<int>(MAX_MESSAGE_IDS); ++msg_id) {
+            if (accounting.message_windows[msg_id].sum.count > 0) {
+                ids.push_back(msg_id);
+            }
+        }
+
+        std::sort(ids.begin(), ids.end(), [](const int lhs, const int rhs) {
+            return accounting.message_windows[lhs].sum.bytes > accounting.message_windows[rhs].sum.bytes;
+        });
+
+        ids.resize(std::min(ids.size(), count));
+
+        std::snprintf(line, sizeof line, "Messages, last %d frames:\n%-4s %-16s %12s %10s %14s\n",
+                      static_cast<int>(BANDWIDTH_WINDOW_FRAMES), "ID", "Name", "Bytes", "Count", "Total bytes");
+        ServerPrint(line);
+
+        for (const auto msg_id : ids) {
+            const auto& window = accounting.message_windows[msg_id].sum;
+            const auto total = MessageBandwidth(msg_id);
+
+            std::snprintf(line, sizeof line, "%-4d %-16s %12llu %10llu %14llu\n", msg_id, MessageName(msg_id),
+                          static_cast<unsigned long long>(window.bytes), static_cast<unsigned long long>(window.count),
+                          static_cast<unsigned long long>(total.bytes));
+            ServerPrint(line);
+        }
+
+        std::snprintf(line, sizeof line, "Clients, last %d frames:\n%-4s %-32s %12s %10s\n",
+                      static_cast<int>(BANDWIDTH_WINDOW_FRAMES), "#", "Name", "Bytes", "Count");
+        ServerPrint(line);
+
+        for (auto index = 0; index < static_cast<int>(MAX_ACCOUNTED_CLIENTS); ++index) {
+            const auto& window = accounting.client_windows[index].sum;
+
+            if (window.count == 0) {
+                continue;
+            }
+
+            const char* name = "(unknown recipients)";
+
+            if (index > 0) {
+                const auto* const client = EntityOfEntIndex(index);
+                name = client != nullptr ? SzFromIndex(client->vars.net_name) : "";
+            }
+
+            std::snprintf(line, sizeof line, "%-4d %-32s %12llu %10llu\n", index, name,
+                          static_cast<unsigned long long>(window.bytes), static_cast<unsigned long long>(window.count));
+            ServerPrint(line);
+        }
+    }
+}
+
+namespace metamod::engine
+{
+    void EnableBandwidthAccounting(const char* const dump_command)
+    {
+        // The engine has no way to remove a server command, so it is added only once.
+        if (dump_command != nullptr && !dump_command_added) {
+            dump_command_added = true;
+            AddServerCommand(dump_command, DumpBandwidth);
+        }
+
+        if (accounting_enabled) {
+            return;
+        }
+
+        accounting_enabled = true;
+
+        // Messages to all clients are accounted to the connected clients before the first StartFrame as well.
+        accounting.receiving_clients = ReceivingClients();
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        metamod::detail::SetInternalHook<&EngineFunctions::message_begin>(&OnMessageBegin, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_byte>(&OnWriteByte, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_char>(&OnWriteByte, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_short>(&OnWriteShort, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_long>(&OnWriteLong, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_angle>(&OnWriteAngle, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_coord>(&OnWriteCoord, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_string>(&OnWriteString, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_entity>(&OnWriteShort, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::message_end>(&OnMessageEnd, false, INT_MIN);
+
+        metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false, INT_MAX);
+    }
+
+    void ResetBandwidthAccounting()
+    {
+        // The tables are too large to be reset by assigning a temporary.
+        for (auto& client_totals : accounting.totals) {
+            client_totals.fill({});
+        }
+
+        accounting.client_totals.fill({});
+        accounting.message_totals.fill({});
+
+        for (auto& window : accounting.client_windows) {
+            window = {};
+        }
+
+        for (auto& window : accounting.message_windows) {
+            window = {};
+        }
+
+        accounting.frame = {};
+    }
+
+    MessageStats ClientBandwidth(const int client_index)
+    {
+        if (client_index < 0 || static_cast<std::size_t>(client_index) >= MAX_ACCOUNTED_CLIENTS) {
+            return {};
+        }
+
+        return accounting.client_totals[client_index];
+    }
+
+    MessageStats ClientBandwidth(const int client_index, const int msg_id)
+    {
+        if (client_index < 0 || static_cast<std::size_t>(client_index) >= MAX_ACCOUNTED_CLIENTS || msg_id < 0 ||
+            static_cast<std::size_t>(msg_id) >= MAX_MESSAGE_IDS) {
+            return {};
+        }
+
+        return accounting.totals[client_index][msg_id];
+    }
+
+    MessageStats ClientWindowBandwidth(const int client_index)
+    {
+        if (client_index < 0 || static_cast<std::size_t>(client_index) >= MAX_ACCOUNTED_CLIENTS) {
+            return {};
+        }
+
+        return accounting.client_windows[client_index].sum;
+    }
+
+    MessageStats MessageBandwidth(const int msg_id)
+    {
+        if (msg_id < 0 || static_cast<std::size_t>(msg_id) >= MAX_MESSAGE_IDS) {
+            return {};
+        }
+
+        return accounting.message_totals[msg_id];
+    }
+
+    MessageStats MessageWindowBandwidth(const int msg_id)
+    {
+        if (msg_id < 0 || static_cast<std::size_t>(msg_id) >= MAX_MESSAGE_IDS) {
+            return {};
+        }
+
+        return accounting.message_windows[msg_id].sum;
+    }
+
+    MessageStats FrameBandwidth()
+    {
+        return accounting.frame;
+    }
+}
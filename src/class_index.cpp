@@ -0,0 +1,279 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/class_index.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct ClassList
+    {
+        std::string name{};
+        std::vector<Edict*> entities{};
+    };
+
+    /**
+     * @brief Position of an entity in the index.
+    */
+    struct IndexedEntity
+    {
+        ClassList* list{};
+        std::size_t position{};
+    };
+
+    /**
+     * @brief Lists by class name; the keys view the names owned by the lists.
+    */
+    std::unordered_map<std::string_view, std::unique_ptr<ClassList>> class_lists{};
+
+    /**
+     * @brief Indexed entities by \c IndexOfEdict.
+    */
+    std::vector<IndexedEntity> indexed_entities{};
+
+    /**
+     * @brief Entities created with \c CreateEntity; their class name is set by the game DLL after the call.
+    */
+    std::vector<Edict*> pending_entities{};
+
+    bool indexing{};
+
+    void Remove(const int index)
+    {
+        if (static_cast<std::size_t>(index) >= indexed_entities.size()) {
+            return;
+        }
+
+        auto& indexed = indexed_entities[index];
+
+        if (indexed.list == nullptr) {
+            return;
+        }
+
+        // Swap with the last entity, so the list stays dense.
+        auto& entities = indexed.list->entities;
+        auto* const last = entities.back();
+        entities[indexed.position] = last;
+        indexed_entities[IndexOfEdict(last)].position = indexed.position;
+        entities.pop_back();
+
+        indexed = {};
+    }
+
+    void Add(Edict* const entity)
+    {
+        if (entity == nullptr || entity->free) {
+            return;
+        }
+
+        const auto index = IndexOfEdict(entity);
+
+        if (index < 0) {
+            return;
+        }
+
+        const auto* const class_name = SzFromIndex(entity->vars.classname);
+        const std::string_view name = class_name != nullptr ? class_name : "";
+
+        if (static_cast<std::size_t>(index) >= indexed_entities.size()) {
+            indexed_entities.resize(static_cast<std::size_t>(index) + 1);
+        }
+        else if (const auto* const list = indexed_entities[index].list; list != nullptr) {
+            if (list->name == name) {
+                return;
+            }
+
+            Remove(index);
+        }
+
+        auto it = class_lists.find(name);
+
+        if (it == class_lists.end()) {
+            auto list = std::make_unique<ClassList>();
+            list->name = name;
+            const std::string_view key = list->name;
+            it = class_lists.emplace(key, std::move(list)).first;
+        }
+
+        auto& entities = it->second->entities;
+        indexed_entities[index] = {it->second.get(), entities.size()};
+        entities.push_back(entity);
+    }
+
+    Edict* OnCreateNamedEntityPost(const Strind /*class_name*/)
+    {
+        Add(OrigRet<Edict*>());
+        SetResult(Result::Ignored);
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Entities created by the game DLL itself (e.g. grenades) are spawned without the \c Spawn hook,
+     * so they are classified on the next lookup.
+    */
+    Edict* OnCreateEntityPost()
+    {
+        if (auto* const entity = OrigRet<Edict*>(); entity != nullptr) {
+            pending_entities.push_back(entity);
+        }
+
+        SetResult(Result::Ignored);
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Players are not created by \c CreateEntity, and their class name is set by \c ClientPutInServer.
+    */
+    void OnClientPutInServerPost(Edict* const client)
+    {
+        Add(client);
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief Bots put in the server by the game DLL or by other plugins bypass the \c ClientPutInServer hook.
+    */
+    Edict* OnCreateFakeClientPost(const char* /*name*/)
+    {
+        if (auto* const client = OrigRet<Edict*>(); client != nullptr) {
+            pending_entities.push_back(client);
+        }
+
+        SetResult(Result::Ignored);
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Entities loaded from the map are not created by \c CreateNamedEntity, and spawn may change the class name.
+    */
+    int OnSpawnPost(Edict* const entity)
+    {
+        Add(entity);
+        SetResult(Result::Ignored);
+
+        return 0;
+    }
+
+    void OnFreeEntityPrivateDataPost(Edict* const entity)
+    {
+        if (const auto index = IndexOfEdict(entity); index >= 0) {
+            Remove(index);
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    void OnServerDeactivatePost()
+    {
+        for (auto& [name, list] : class_lists) {
+            list->entities.clear();
+        }
+
+        indexed_entities.clear();
+        pending_entities.clear();
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief Indexes the entities created since the last lookup; those that have no class name yet stay pending.
+    */
+    void ClassifyPendingEntities()
+    {
+        std::size_t kept = 0;
+
+        for (auto* const entity : pending_entities) {
+            if (entity->free || entity->private_data == nullptr) {
+                continue;
+            }
+
+            if (entity->vars.classname == 0) {
+                pending_entities[kept++] = entity;
+            }
+            else {
+                Add(entity);
+            }
+        }
+
+        pending_entities.resize(kept);
+    }
+
+    void StartIndexing()
+    {
+        indexing = true;
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        metamod::detail::SetInternalHook<&EngineFunctions::create_named_entity>(&OnCreateNamedEntityPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::spawn>(&OnSpawnPost, true);
+        metamod::detail::SetInternalHook<&DllNewFunctions::free_entity_private_data>(&OnFreeEntityPrivateDataPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivatePost, true);
+        metamod::detail::SetInternalHook<&EngineFunctions::create_entity>(&OnCreateEntityPost, true);
+        metamod::detail::SetInternalHook<&EngineFunctions::create_fake_client>(&OnCreateFakeClientPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::client_put_in_server>(&OnClientPutInServerPost, true);
+
+        // The entities that exist already are indexed once.
+        for (auto index = 0; index < g_global_vars->max_entities; ++index) {
+            if (auto* const entity = EntityOfEntIndex(index); entity != nullptr && entity->private_data != nullptr) {
+                Add(entity);
+            }
+        }
+    }
+}
+
+namespace metamod::engine
+{
+    const std::vector<Edict*>& EntitiesByClass(const char* const class_name)
+    {
+        static const std::vector<Edict*> empty{};
+
+        if (class_name == nullptr) {
+            return empty;
+        }
+
+        if (!indexing) {
+            StartIndexing();
+        }
+        else if (!pending_entities.empty()) {
+            ClassifyPendingEntities();
+        }
+
+        const auto it = class_lists.find(class_name);
+
+        return it != class_lists.end() ? it->second->entities : empty;
+    }
+
+    void UpdateClassIndex(Edict* const entity)
+    {
+        if (indexing) {
+            Add(entity);
+        }
+    }
+}
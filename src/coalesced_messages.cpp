@@ -0,0 +1,197 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/coalesced_messages.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct CoalescedMessage
+    {
+        /**
+         * @brief Entity index of the client, or 0 for a message to all clients.
+        */
+        int client_index{};
+
+        int key{};
+        int msg_id{};
+        bool reliable{};
+        bool queued{};
+        MessageReplay replay{};
+
+        /**
+         * @brief The message saved with \c MessageBuilder::Save.
+        */
+        std::vector<std::uint8_t> data{};
+    };
+
+    /**
+     * @brief Messages in the order they were first queued; only the first \c message_count entries are in use.
+     * Entries are not destroyed when the queue is emptied, so their buffers are reused from frame to frame.
+    */
+    std::vector<CoalescedMessage> coalesced_messages{};
+
+    /**
+     * @brief Number of entries in use, sent or queued.
+    */
+    std::size_t message_count{};
+
+    /**
+     * @brief Number of queued messages.
+    */
+    std::size_t queued_count{};
+
+    /**
+     * @brief Positions of the queued messages by \c MessageKey.
+    */
+    std::unordered_map<std::uint64_t, std::size_t> queued_positions{};
+
+    bool flush_hooked{};
+
+    /**
+     * @brief Packs the client index, message ID and key of a message.
+    */
+    std::uint64_t MessageKey(const int client_index, const int msg_id, const int key)
+    {
+        return std::uint64_t{static_cast<std::uint16_t>(client_index)} << 48 |
+               std::uint64_t{static_cast<std::uint16_t>(msg_id)} << 32 | static_cast<std::uint32_t>(key);
+    }
+
+    bool IsConnected(const Edict* const client)
+    {
+        return client != nullptr && !client->free && (client->vars.flags & FL_CLIENT);
+    }
+
+    void Send(CoalescedMessage& entry)
+    {
+        entry.queued = false;
+        --queued_count;
+        queued_positions.erase(MessageKey(entry.client_index, entry.msg_id, entry.key));
+
+        if (entry.client_index == 0) {
+            MessageBegin(entry.reliable ? MessageType::All : MessageType::Broadcast, entry.msg_id);
+        }
+        else if (auto* const client = EntityOfEntIndex(entry.client_index); IsConnected(client)) {
+            MessageBegin(entry.reliable ? MessageType::One : MessageType::OneUnreliable, entry.msg_id, nullptr, client);
+        }
+        else {
+            return;
+        }
+
+        WriteSavedMessage(entry.data.data(), entry.data.size(), entry.replay);
+        MessageEnd();
+    }
+
+    /**
+     * @brief Sends the queued messages of the client, or all of them if \c client_index is negative.
+    */
+    void Flush(const int client_index)
+    {
+        // Index-based loop: sending a message may queue new ones.
+        for (std::size_t i = 0; i < message_count && queued_count > 0; ++i) {
+            if (auto& entry = coalesced_messages[i]; entry.queued && (client_index < 0 || entry.client_index == client_index)) {
+                Send(entry);
+            }
+        }
+
+        if (queued_count == 0) {
+            message_count = 0;
+        }
+    }
+
+    void OnStartFramePost()
+    {
+        Flush(-1);
+        SetResult(Result::Ignored);
+    }
+
+    void OnPlayerPostThinkPost(Edict* const client)
+    {
+        if (queued_count > 0) {
+            Flush(IndexOfEdict(client));
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    void OnServerDeactivate()
+    {
+        message_count = 0;
+        queued_count = 0;
+        queued_positions.clear();
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::engine
+{
+    void SendCoalesced(const MessageBuilder& message, Edict* const client, const int key, const bool reliable,
+                       const MessageReplay replay)
+    {
+        if (message.Overflowed()) {
+            AlertMessage(AlertType::Logged, "Send coalesced: message %d exceeds %d bytes and was not queued.\n",
+                         message.MsgId(), static_cast<int>(MAX_MESSAGE_SIZE));
+            return;
+        }
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        if (!flush_hooked) {
+            flush_hooked = true;
+            metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFramePost, true);
+            metamod::detail::SetInternalHook<&DllFunctions::player_post_think>(&OnPlayerPostThinkPost, true);
+            metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivate, false);
+        }
+
+        const auto client_index = client != nullptr ? IndexOfEdict(client) : 0;
+
+        const auto [position, inserted] = queued_positions.try_emplace(MessageKey(client_index, message.MsgId(), key),
+                                                                        message_count);
+
+        if (inserted) {
+            if (message_count == coalesced_messages.size()) {
+                coalesced_messages.emplace_back();
+            }
+
+            ++message_count;
+            ++queued_count;
+        }
+
+        auto& entry = coalesced_messages[position->second];
+        entry.client_index = client_index;
+        entry.key = key;
+        entry.msg_id = message.MsgId();
+        entry.reliable = reliable;
+        entry.queued = true;
+        entry.data.clear();
+        entry.replay = message.Save(entry.data, replay);
+    }
+
+    void FlushCoalescedMessages()
+    {
+        Flush(-1);
+    }
+}
@@ -31,7 +31,6 @@ namespace metamod::engine::detail
         if (hooks_table && *interface_version == ENGINE_INTERFACE_VERSION) {
             std::memcpy(hooks_table, engine_hooks, sizeof(EngineFunctions));
 
-            delete engine_hooks;
             engine_hooks = hooks_table;
 
             return true;
@@ -48,7 +47,6 @@ namespace metamod::engine::detail
             *interface_version = ENGINE_INTERFACE_VERSION;
         }
 
-        delete engine_hooks;
         engine_hooks = nullptr;
 
         return false;
@@ -62,7 +60,6 @@ namespace metamod::engine::detail
         if (hooks_table && *interface_version == ENGINE_INTERFACE_VERSION) {
             std::memcpy(hooks_table, engine_post_hooks, sizeof(EngineFunctions));
 
-            delete engine_post_hooks;
             engine_post_hooks = hooks_table;
 
             return true;
@@ -79,7 +76,6 @@ namespace metamod::engine::detail
             *interface_version = ENGINE_INTERFACE_VERSION;
         }
 
-        delete engine_post_hooks;
         engine_post_hooks = nullptr;
 
         return false;
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/entity_data.h>
+#include <metamod/api.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+using namespace metamod::engine::detail;
+
+namespace
+{
+    bool storages_hooked{};
+
+    void OnFreeEntityPrivateDataPost(Edict* const entity)
+    {
+        if (const auto index = IndexOfEdict(entity); index >= 0) {
+            for (auto* storage = entity_storages; storage != nullptr; storage = storage->next) {
+                storage->Destroy(static_cast<std::size_t>(index));
+            }
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    void OnServerDeactivatePost()
+    {
+        for (auto* storage = entity_storages; storage != nullptr; storage = storage->next) {
+            storage->DestroyAll();
+        }
+
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::engine::detail
+{
+    void EntityStorage::Link()
+    {
+        if (linked_) {
+            return;
+        }
+
+        // Linked on the first value rather than on construction: storages are usually
+        // static objects, constructed before the plugin is attached.
+        linked_ = true;
+        next = entity_storages;
+        entity_storages = this;
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        if (!storages_hooked) {
+            storages_hooked = true;
+            metamod::detail::SetInternalHook<&DllNewFunctions::free_entity_private_data>(&OnFreeEntityPrivateDataPost, true);
+            metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivatePost, true);
+        }
+    }
+
+    void EntityStorage::Unlink()
+    {
+        if (!linked_) {
+            return;
+        }
+
+        for (auto** link = &entity_storages; *link != nullptr; link = &(*link)->next) {
+            if (*link == this) {
+                *link = next;
+                break;
+            }
+        }
+
+        linked_ = false;
+        next = nullptr;
+    }
+}
@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/entity_filter.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <cstring>
+
+using namespace cssdk;
+using namespace metamod::engine;
+
+namespace
+{
+    using metamod::gamedll::detail::filtered_entities;
+
+    bool invalidation_hooked{};
+
+    /**
+     * @brief Forgets the filter state of the given entity slot.
+    */
+    void InvalidateEntity(const Edict* const entity)
+    {
+        const auto index = IndexOfEdict(entity);
+
+        if (index >= 0 && static_cast<std::size_t>(index) < filtered_entities.size()) {
+            filtered_entities[index].classified = false;
+        }
+    }
+
+    /**
+     * @brief Spawn may change the class name of the entity, so it is matched again on its next call.
+    */
+    int OnSpawnPost(Edict* const entity)
+    {
+        InvalidateEntity(entity);
+        metamod::SetResult(metamod::Result::Ignored);
+
+        return 0;
+    }
+
+    /**
+     * @brief The slot of a freed entity will be reused by another entity.
+    */
+    void OnFreeEntityPrivateDataPost(Edict* const entity)
+    {
+        InvalidateEntity(entity);
+        metamod::SetResult(metamod::Result::Ignored);
+    }
+
+    bool Matches(const metamod::gamedll::EntityFilter& filter, const char* const class_name, const int index)
+    {
+        if (std::find(filter.indices.cbegin(), filter.indices.cend(), index) != filter.indices.cend()) {
+            return true;
+        }
+
+        return std::any_of(filter.class_names.cbegin(), filter.class_names.cend(), [class_name](const std::string& name) {
+            return name == class_name;
+        });
+    }
+}
+
+namespace metamod::gamedll::detail
+{
+    std::size_t RegisterEntityFilter(const gamedll::EntityFilter& filter)
+    {
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        if (!invalidation_hooked) {
+            invalidation_hooked = true;
+            metamod::detail::SetInternalHook<&DllFunctions::spawn>(&OnSpawnPost, true);
+            metamod::detail::SetInternalHook<&DllNewFunctions::free_entity_private_data>(&OnFreeEntityPrivateDataPost, true);
+        }
+
+        const auto it = std::find_if(entity_filters.begin(), entity_filters.end(), [&filter](const RegisteredEntityFilter& other) {
+            return other.uses > 0 && other.filter.class_names == filter.class_names && other.filter.indices == filter.indices;
+        });
+
+        if (it != entity_filters.end()) {
+            ++it->uses;
+            return static_cast<std::size_t>(it - entity_filters.begin());
+        }
+
+        // The id of a filter no callback uses any more is reused.
+        const auto unused = std::find_if(entity_filters.cbegin(), entity_filters.cend(), [](const RegisteredEntityFilter& other) {
+            return other.uses == 0;
+        });
+
+        const auto id = static_cast<std::size_t>(unused - entity_filters.cbegin());
+
+        if (id == entity_filters.size()) {
+            if (id >= MAX_ENTITY_FILTERS) {
+                AlertMessage(AlertType::Logged, "Register entity filter: too many filters; maximum = %d.\n",
+                             static_cast<int>(MAX_ENTITY_FILTERS));
+                return MAX_ENTITY_FILTERS;
+            }
+
+            entity_filters.emplace_back();
+        }
+
+        entity_filters[id] = {filter, 1};
+
+        // Every entity has to be matched against the new filter as well.
+        for (auto& state : filtered_entities) {
+            state.classified = false;
+        }
+
+        return id;
+    }
+
+    void ReleaseEntityFilter(const std::size_t id)
+    {
+        if (id < entity_filters.size() && entity_filters[id].uses > 0 && --entity_filters[id].uses == 0) {
+            entity_filters[id].filter = {};
+        }
+    }
+
+    std::uint64_t ClassifyEntity(const Edict* const entity, const int index)
+    {
+        if (entity == nullptr || index < 0) {
+            return 0;
+        }
+
+        const auto* const class_name = SzFromIndex(entity->vars.classname);
+        std::uint64_t filters{};
+
+        for (std::size_t id = 0; id < entity_filters.size(); ++id) {
+            if (Matches(entity_filters[id].filter, class_name ? class_name : "", index)) {
+                filters |= std::uint64_t{1} << id;
+            }
+        }
+
+        if (static_cast<std::size_t>(index) >= filtered_entities.size()) {
+            filtered_entities.resize(static_cast<std::size_t>(index) + 1);
+        }
+
+        filtered_entities[index] = {filters, true};
+
+        return filters;
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/entity_handle.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+using namespace metamod::engine::detail;
+
+namespace
+{
+    bool tracking{};
+
+    FORCEINLINE void NextGeneration(HandleSlot& slot)
+    {
+        slot.generation = slot.generation < EntityHandle::MAX_GENERATION ? slot.generation + 1 : 1;
+    }
+
+    void Release(const Edict* const entity)
+    {
+        if (const auto index = IndexOfEdict(entity); index >= 0 && static_cast<std::size_t>(index) < handle_slots.size()) {
+            auto& slot = handle_slots[index];
+
+            // Freeing an entity calls both hooks; the generation is incremented once.
+            if (slot.entity != nullptr) {
+                slot.entity = nullptr;
+                NextGeneration(slot);
+            }
+        }
+    }
+
+    void OnFreeEntityPrivateDataPost(Edict* const entity)
+    {
+        Release(entity);
+        SetResult(Result::Ignored);
+    }
+
+    void OnRemoveEntityPost(Edict* const entity)
+    {
+        Release(entity);
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The edicts may be reallocated by the next map.
+    */
+    void OnServerDeactivatePost()
+    {
+        for (auto& slot : handle_slots) {
+            slot.entity = nullptr;
+            NextGeneration(slot);
+        }
+
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::engine::detail
+{
+    std::uint32_t TrackEntity(Edict* const entity, const int index)
+    {
+        if (!tracking) {
+            tracking = true;
+
+            // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+            metamod::detail::SetInternalHook<&DllNewFunctions::free_entity_private_data>(&OnFreeEntityPrivateDataPost, true);
+            metamod::detail::SetInternalHook<&EngineFunctions::remove_entity>(&OnRemoveEntityPost, true);
+            metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivatePost, true);
+        }
+
+        if (index < 0 || static_cast<std::uint32_t>(index) > EntityHandle::INDEX_MASK) {
+            return 0;
+        }
+
+        if (static_cast<std::size_t>(index) >= handle_slots.size()) {
+            handle_slots.resize(static_cast<std::size_t>(index) + 1);
+        }
+
+        auto& slot = handle_slots[index];
+        slot.entity = entity;
+
+        return slot.generation;
+    }
+}
+
+namespace metamod::engine
+{
+    EntityHandle::EntityHandle(Edict* const entity)
+    {
+        if (entity == nullptr || entity->free) {
+            return;
+        }
+
+        const auto index = IndexOfEdict(entity);
+
+        if (const auto generation = TrackEntity(entity, index); generation != 0) {
+            value_ = generation << INDEX_BITS | static_cast<std::uint32_t>(index);
+        }
+    }
+}
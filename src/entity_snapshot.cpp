@@ -0,0 +1,318 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/entity_snapshot.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct AlignedDelete
+    {
+        void operator()(void* const data) const
+        {
+            ::operator delete[](data, std::align_val_t{SNAPSHOT_ALIGNMENT});
+        }
+    };
+
+    /**
+     * @brief Array aligned to \c SNAPSHOT_ALIGNMENT bytes.
+    */
+    template <typename T>
+    struct AlignedArray
+    {
+        std::unique_ptr<T[], AlignedDelete> data{};
+
+        void Allocate(const std::size_t size)
+        {
+            data.reset(static_cast<T*>(::operator new[](size * sizeof(T), std::align_val_t{SNAPSHOT_ALIGNMENT})));
+        }
+
+        [[nodiscard]] T* Get(const bool selected) const
+        {
+            return selected ? data.get() : nullptr;
+        }
+    };
+
+    struct SnapshotBuffers
+    {
+        AlignedArray<Edict*> entities{};
+        AlignedArray<int> indices{};
+        AlignedArray<std::uint32_t> dirty{};
+        AlignedArray<float> origin_x{};
+        AlignedArray<float> origin_y{};
+        AlignedArray<float> origin_z{};
+        AlignedArray<float> velocity_x{};
+        AlignedArray<float> velocity_y{};
+        AlignedArray<float> velocity_z{};
+        AlignedArray<int> flags{};
+        AlignedArray<float> health{};
+        AlignedArray<int> team{};
+
+        void Allocate(const std::size_t size)
+        {
+            entities.Allocate(size);
+            indices.Allocate(size);
+            dirty.Allocate(size);
+            origin_x.Allocate(size);
+            origin_y.Allocate(size);
+            origin_z.Allocate(size);
+            velocity_x.Allocate(size);
+            velocity_y.Allocate(size);
+            velocity_z.Allocate(size);
+            flags.Allocate(size);
+            health.Allocate(size);
+            team.Allocate(size);
+        }
+    };
+
+    /**
+     * @brief Row of an entity in the snapshot of the given frame.
+    */
+    struct SnapshotRow
+    {
+        std::uint32_t frame{};
+        std::uint32_t row{};
+
+        /**
+         * @brief Serial number of the entity, which changes when its slot is reused.
+        */
+        int serial_number{};
+    };
+
+    struct SnapshotState
+    {
+        SnapshotBuffers current{};
+        SnapshotBuffers previous{};
+        std::size_t capacity{};
+
+        /**
+         * @brief Rows by entity index.
+        */
+        std::vector<SnapshotRow> rows{};
+
+        EntitySnapshot view{};
+        bool hooked{};
+    };
+
+    SnapshotState state{};
+
+    /**
+     * @brief Copies the selected fields of the entity into the row and returns the fields that changed.
+    */
+    std::uint32_t CopyRow(const EntityVars& vars, const std::size_t row, const std::uint32_t fields, const long long previous_row)
+    {
+        auto& current = state.current;
+        const auto& previous = state.previous;
+        const auto is_new = previous_row < 0;
+        std::uint32_t dirty{};
+
+        if (fields & SNAPSHOT_ORIGIN) {
+            current.origin_x.data[row] = vars.origin.x;
+            current.origin_y.data[row] = vars.origin.y;
+            current.origin_z.data[row] = vars.origin.z;
+
+            if (is_new || vars.origin.x != previous.origin_x.data[previous_row] ||
+                vars.origin.y != previous.origin_y.data[previous_row] || vars.origin.z != previous.origin_z.data[previous_row]) {
+                dirty |= SNAPSHOT_ORIGIN;
+            }
+        }
+
+        if (fields & SNAPSHOT_VELOCITY) {
+            current.velocity_x.data[row] = vars.velocity.x;
+            current.velocity_y.data[row] = vars.velocity.y;
+            current.velocity_z.data[row] = vars.velocity.z;
+
+            if (is_new || vars.velocity.x != previous.velocity_x.data[previous_row] ||
+                vars.velocity.y != previous.velocity_y.data[previous_row] ||
+                vars.velocity.z != previous.velocity_z.data[previous_row]) {
+                dirty |= SNAPSHOT_VELOCITY;
+            }
+        }
+
+        if (fields & SNAPSHOT_FLAGS) {
+            current.flags.data[row] = vars.flags;
+
+            if (is_new || vars.flags != previous.flags.data[previous_row]) {
+                dirty |= SNAPSHOT_FLAGS;
+            }
+        }
+
+        if (fields & SNAPSHOT_HEALTH) {
+            current.health.data[row] = vars.health;
+
+            if (is_new || vars.health != previous.health.data[previous_row]) {
+                dirty |= SNAPSHOT_HEALTH;
+            }
+        }
+
+        if (fields & SNAPSHOT_TEAM) {
+            current.team.data[row] = vars.team;
+
+            if (is_new || vars.team != previous.team.data[previous_row]) {
+                dirty |= SNAPSHOT_TEAM;
+            }
+        }
+
+        return dirty;
+    }
+
+    template <typename T>
+    void ClearPadding(const AlignedArray<T>& array, const std::size_t count, const std::size_t padded_count)
+    {
+        std::fill(array.data.get() + count, array.data.get() + padded_count, T{});
+    }
+
+    void TakeSnapshot()
+    {
+        const auto max_entities = static_cast<std::size_t>(g_global_vars->max_entities);
+        const auto capacity = (max_entities + SNAPSHOT_ROW_PADDING - 1) / SNAPSHOT_ROW_PADDING * SNAPSHOT_ROW_PADDING;
+
+        if (capacity > state.capacity) {
+            state.current.Allocate(capacity);
+            state.previous.Allocate(capacity);
+            state.capacity = capacity;
+
+            // The new buffers hold no previous snapshot, so no row is compared with it.
+            ++state.view.frame;
+        }
+
+        if (state.rows.size() < max_entities) {
+            state.rows.resize(max_entities);
+        }
+
+        // The previous snapshot becomes the reference of the dirty tracking.
+        std::swap(state.current, state.previous);
+
+        auto& view = state.view;
+        const auto previous_frame = view.frame;
+        const auto frame = previous_frame + 1;
+        const auto fields = view.fields;
+        std::size_t count{};
+
+        for (std::size_t index = 0; index < max_entities; ++index) {
+            auto* const entity = EntityOfEntIndex(static_cast<int>(index));
+
+            if (entity == nullptr || entity->free || entity->private_data == nullptr) {
+                continue;
+            }
+
+            auto& row = state.rows[index];
+            const auto is_tracked = row.frame == previous_frame && previous_frame != 0 && row.serial_number == entity->serial_number;
+            const auto previous_row = is_tracked ? static_cast<long long>(row.row) : -1;
+
+            state.current.entities.data[count] = entity;
+            state.current.indices.data[count] = static_cast<int>(index);
+            state.current.dirty.data[count] = CopyRow(entity->vars, count, fields, previous_row);
+            row = {frame, static_cast<std::uint32_t>(count), entity->serial_number};
+            ++count;
+        }
+
+        const auto padded_count = (count + SNAPSHOT_ROW_PADDING - 1) / SNAPSHOT_ROW_PADDING * SNAPSHOT_ROW_PADDING;
+        const auto& current = state.current;
+
+        ClearPadding(current.entities, count, padded_count);
+        ClearPadding(current.indices, count, padded_count);
+        ClearPadding(current.dirty, count, padded_count);
+
+        if (fields & SNAPSHOT_ORIGIN) {
+            ClearPadding(current.origin_x, count, padded_count);
+            ClearPadding(current.origin_y, count, padded_count);
+            ClearPadding(current.origin_z, count, padded_count);
+        }
+
+        if (fields & SNAPSHOT_VELOCITY) {
+            ClearPadding(current.velocity_x, count, padded_count);
+            ClearPadding(current.velocity_y, count, padded_count);
+            ClearPadding(current.velocity_z, count, padded_count);
+        }
+
+        if (fields & SNAPSHOT_FLAGS) {
+            ClearPadding(current.flags, count, padded_count);
+        }
+
+        if (fields & SNAPSHOT_HEALTH) {
+            ClearPadding(current.health, count, padded_count);
+        }
+
+        if (fields & SNAPSHOT_TEAM) {
+            ClearPadding(current.team, count, padded_count);
+        }
+
+        view.count = count;
+        view.padded_count = padded_count;
+        view.frame = frame;
+        view.entities = current.entities.data.get();
+        view.indices = current.indices.data.get();
+        view.dirty = current.dirty.data.get();
+        view.origin_x = current.origin_x.Get(fields & SNAPSHOT_ORIGIN);
+        view.origin_y = current.origin_y.Get(fields & SNAPSHOT_ORIGIN);
+        view.origin_z = current.origin_z.Get(fields & SNAPSHOT_ORIGIN);
+        view.velocity_x = current.velocity_x.Get(fields & SNAPSHOT_VELOCITY);
+        view.velocity_y = current.velocity_y.Get(fields & SNAPSHOT_VELOCITY);
+        view.velocity_z = current.velocity_z.Get(fields & SNAPSHOT_VELOCITY);
+        view.flags = current.flags.Get(fields & SNAPSHOT_FLAGS);
+        view.health = current.health.Get(fields & SNAPSHOT_HEALTH);
+        view.team = current.team.Get(fields & SNAPSHOT_TEAM);
+    }
+
+    void OnStartFrame()
+    {
+        TakeSnapshot();
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::engine
+{
+    void EnableEntitySnapshot(const std::uint32_t fields)
+    {
+        const auto frame = state.view.frame;
+        state.view = {};
+        state.view.fields = fields;
+
+        // Rows of the snapshots taken with other fields are not compared.
+        state.view.frame = frame + 1;
+
+        // An internal hook is kept when the plugin replaces or clears its hooks, so it is installed only once.
+        if (fields != 0 && !state.hooked) {
+            metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false, INT_MAX);
+        }
+        else if (fields == 0 && state.hooked) {
+            RemoveHook<&DllFunctions::start_frame>(OnStartFrame, false);
+        }
+
+        state.hooked = fields != 0;
+    }
+
+    const EntitySnapshot& GetEntitySnapshot()
+    {
+        return state.view;
+    }
+}
@@ -29,10 +29,9 @@ namespace metamod::gamedll::detail
     */
     qboolean ExportDllHooks(DllFunctions* hooks_table, int* interface_version)
     {
-        if (hooks_table && *interface_version == INTERFACE_VERSION) {
+        if (hooks_table && *interface_version == cssdk::INTERFACE_VERSION) {
             std::memcpy(hooks_table, dll_hooks, sizeof(DllFunctions));
 
-            delete dll_hooks;
             dll_hooks = hooks_table;
 
             return true;
@@ -41,15 +40,14 @@ namespace metamod::gamedll::detail
         if (!hooks_table) {
             AlertMessage(AlertType::Logged, "Export gamedll hooks: hooks_table is null.\n");
         }
-        else if (*interface_version != INTERFACE_VERSION) {
+        else if (*interface_version != cssdk::INTERFACE_VERSION) {
             AlertMessage(AlertType::Logged, "Export gamedll hooks: interface version mismatch; requested = %d; ours = %d.\n",
-                         *interface_version, INTERFACE_VERSION);
+                         *interface_version, cssdk::INTERFACE_VERSION);
 
             // Tell metamod what version we had, so it can figure out who is out of date.
-            *interface_version = INTERFACE_VERSION;
+            *interface_version = cssdk::INTERFACE_VERSION;
         }
 
-        delete dll_hooks;
         dll_hooks = nullptr;
 
         return false;
@@ -60,10 +58,9 @@ namespace metamod::gamedll::detail
     */
     qboolean ExportDllPostHooks(DllFunctions* hooks_table, int* interface_version)
     {
-        if (hooks_table && *interface_version == INTERFACE_VERSION) {
+        if (hooks_table && *interface_version == cssdk::INTERFACE_VERSION) {
             std::memcpy(hooks_table, dll_post_hooks, sizeof(DllFunctions));
 
-            delete dll_post_hooks;
             dll_post_hooks = hooks_table;
 
             return true;
@@ -72,15 +69,14 @@ namespace metamod::gamedll::detail
         if (!hooks_table) {
             AlertMessage(AlertType::Logged, "Export gamedll post hooks: hooks_table is null.\n");
         }
-        else if (*interface_version != INTERFACE_VERSION) {
+        else if (*interface_version != cssdk::INTERFACE_VERSION) {
             AlertMessage(AlertType::Logged, "Export gamedll post hooks: interface version mismatch; requested = %d; ours = %d.\n",
-                         *interface_version, INTERFACE_VERSION);
+                         *interface_version, cssdk::INTERFACE_VERSION);
 
             // Tell metamod what version we had, so it can figure out who is out of date.
-            *interface_version = INTERFACE_VERSION;
+            *interface_version = cssdk::INTERFACE_VERSION;
         }
 
-        delete dll_post_hooks;
         dll_post_hooks = nullptr;
 
         return false;
@@ -94,7 +90,6 @@ namespace metamod::gamedll::detail
         if (hooks_table && *interface_version == DLL_NEW_FUNCTIONS_VERSION) {
             std::memcpy(hooks_table, dll_new_hooks, sizeof(DllNewFunctions));
 
-            delete dll_new_hooks;
             dll_new_hooks = hooks_table;
 
             return true;
@@ -111,7 +106,6 @@ namespace metamod::gamedll::detail
             *interface_version = DLL_NEW_FUNCTIONS_VERSION;
         }
 
-        delete dll_new_hooks;
         dll_new_hooks = nullptr;
 
         return false;
@@ -125,7 +119,6 @@ namespace metamod::gamedll::detail
         if (hooks_table && *interface_version == DLL_NEW_FUNCTIONS_VERSION) {
             std::memcpy(hooks_table, dll_new_post_hooks, sizeof(DllNewFunctions));
 
-            delete dll_new_post_hooks;
             dll_new_post_hooks = hooks_table;
 
             return true;
@@ -142,7 +135,6 @@ namespace metamod::gamedll::detail
             *interface_version = DLL_NEW_FUNCTIONS_VERSION;
         }
 
-        delete dll_new_post_hooks;
         dll_new_post_hooks = nullptr;
 
         return false;
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/hook_profiler.h>
+
+#ifdef META_HOOK_PROFILER
+
+#include <metamod/engine.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace metamod::engine;
+using namespace metamod::detail;
+
+namespace
+{
+    /**
+     * @brief Returns the upper bound, in nanoseconds, of the histogram bucket containing the given fraction of calls.
+    */
+    unsigned long long Percentile(const HookProfile& profile, const double fraction)
+    {
+        const auto target = static_cast<std::uint64_t>(static_cast<double>(profile.calls) * fraction);
+        std::uint64_t count{};
+
+        for (std::size_t bucket = 0; bucket < HOOK_PROFILE_BUCKETS; ++bucket) {
+            count += profile.histogram[bucket];
+
+            if (count > target) {
+                return 1ULL << bucket;
+            }
+        }
+
+        return profile.max_ns;
+    }
+
+    void ResetHookProfiles()
+    {
+        for (auto* profile = hook_profiles; profile != nullptr; profile = profile->next) {
+            profile->calls = 0;
+            profile->total_ns = 0;
+            profile->max_ns = 0;
+            profile->histogram.fill(0);
+        }
+    }
+}
+
+namespace metamod::detail
+{
+    void DumpHookProfiles()
+    {
+        std::size_t count = 10;
+
+        for (auto i = 1; i < CmdArgc(); ++i) {
+            if (const auto* const arg = CmdArgv(i); std::strcmp(arg, "reset") == 0) {
+                ResetHookProfiles();
+                ServerPrint("Hook profiles reset.\n");
+                return;
+            }
+            else if (const auto value = std::atoi(arg); value > 0) {
+                count = static_cast<std::size_t>(value);
+            }
+        }
+
+        std::vector<const HookProfile*> profiles{};
+
+        for (const auto* profile = hook_profiles; profile != nullptr; profile = profile->next) {
+            if (profile->calls > 0) {
+                profiles.push_back(profile);
+            }
+        }
+
+        std::sort(profiles.begin(), profiles.end(), [](const HookProfile* lhs, const HookProfile* rhs) {
+            return lhs->total_ns > rhs->total_ns;
+        });
+
+        if (profiles.size() > count) {
+            profiles.resize(count);
+        }
+
+        char line[256];
+        std::snprintf(line, sizeof line, "%-48s %-4s %12s %12s %10s %10s %10s %10s\n", "Slot", "Post", "Calls", "Total ms",
+                      "Avg ns", "p50 ns", "p99 ns", "Max ns");
+        ServerPrint(line);
+
+        for (const auto* const profile : profiles) {
+            std::snprintf(line, sizeof line, "%-48.*s %-4s %12llu %12.3f %10llu %10llu %10llu %10llu\n",
+                          static_cast<int>(profile->name.size()), profile->name.data(), profile->post ? "yes" : "no",
+                          static_cast<unsigned long long>(profile->calls), static_cast<double>(profile->total_ns) / 1e6,
+                          static_cast<unsigned long long>(profile->total_ns / profile->calls), Percentile(*profile, 0.5),
+                          Percentile(*profile, 0.99), static_cast<unsigned long long>(profile->max_ns));
+            ServerPrint(line);
+        }
+    }
+}
+
+#endif
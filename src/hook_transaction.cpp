@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/hook_transaction.h>
+#include <cssdk/engine/eiface.h>
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_chain.h>
+#include <metamod/hook_slot.h>
+#include <climits>
+#include <utility>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine::detail;
+using namespace metamod::gamedll::detail;
+
+namespace
+{
+    struct StagedHooks
+    {
+        std::function<void()> changes{};
+        bool replace{};
+    };
+
+    /**
+     * @brief Scratch copies of the hook tables the staged changes are applied to.
+    */
+    struct ScratchHookTables
+    {
+        EngineFunctions engine_hooks{};
+        EngineFunctions engine_post_hooks{};
+        DllFunctions dll_hooks{};
+        DllFunctions dll_post_hooks{};
+        DllNewFunctions dll_new_hooks{};
+        DllNewFunctions dll_new_post_hooks{};
+    };
+
+    std::vector<StagedHooks> staged_hooks{};
+    ScratchHookTables scratch{};
+    bool commit_hooked{};
+
+    /**
+     * @brief Points the hook table pointer at a scratch copy of the table.
+     *
+     * @return The original table.
+    */
+    template <typename TTable>
+    TTable* Redirect(TTable*& hooks, TTable& scratch_table)
+    {
+        auto* const table = hooks;
+
+        if (table != nullptr) {
+            scratch_table = *table;
+            hooks = &scratch_table;
+        }
+
+        return table;
+    }
+
+    /**
+     * @brief Copies the scratch table into the original table and points the hook table pointer back at it.
+    */
+    template <typename TTable>
+    void Restore(TTable*& hooks, TTable* const table)
+    {
+        if (table != nullptr) {
+            *table = *hooks;
+            hooks = table;
+        }
+    }
+
+    void OnStartFrame()
+    {
+        CommitStagedHooks();
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod
+{
+    void StageHooks(std::function<void()> changes, const bool replace)
+    {
+        staged_hooks.push_back(StagedHooks{std::move(changes), replace});
+
+        // Installed once and kept: removing it from the chain while it is being dispatched
+        // would skip the callback that follows it.
+        if (!commit_hooked) {
+            commit_hooked = true;
+            detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false, INT_MAX);
+        }
+    }
+
+    void CommitStagedHooks()
+    {
+        if (staged_hooks.empty()) {
+            return;
+        }
+
+        // A replace would erase the entries of a chain that is being dispatched (e.g. the StartFrame
+        // chain the commit hook runs in), so the commit is applied when the dispatch returns.
+        if (detail::dispatch_depth > 0) {
+            detail::deferred_dispatch_action = &CommitStagedHooks;
+            return;
+        }
+
+        auto pending = std::move(staged_hooks);
+        staged_hooks.clear();
+
+        auto* const engine = Redirect(engine_hooks, scratch.engine_hooks);
+        auto* const engine_post = Redirect(engine_post_hooks, scratch.engine_post_hooks);
+        auto* const dll = Redirect(dll_hooks, scratch.dll_hooks);
+        auto* const dll_post = Redirect(dll_post_hooks, scratch.dll_post_hooks);
+        auto* const dll_new = Redirect(dll_new_hooks, scratch.dll_new_hooks);
+        auto* const dll_new_post = Redirect(dll_new_post_hooks, scratch.dll_new_post_hooks);
+
+        for (auto& staged : pending) {
+            if (staged.replace) {
+                // The hooks of the SDK facilities, including the commit hook itself, are kept.
+                ClearEngineHooks();
+                ClearGameDllHooks();
+            }
+
+            staged.changes();
+        }
+
+        Restore(engine_hooks, engine);
+        Restore(engine_post_hooks, engine_post);
+        Restore(dll_hooks, dll);
+        Restore(dll_post_hooks, dll_post);
+        Restore(dll_new_hooks, dll_new);
+        Restore(dll_new_post_hooks, dll_new_post);
+    }
+}
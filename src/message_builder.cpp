@@ -0,0 +1,276 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/message_builder.h>
+#include <metamod/engine.h>
+#include <metamod/message_hooks.h>
+#include <cstring>
+
+using namespace cssdk;
+
+namespace
+{
+    int ReadInt(const std::uint8_t* const data, const std::size_t size)
+    {
+        std::uint32_t bits{};
+
+        for (std::size_t i = 0; i < size; ++i) {
+            bits |= static_cast<std::uint32_t>(data[i]) << (i * 8);
+        }
+
+        return static_cast<int>(bits);
+    }
+
+    /**
+     * @brief Size of the value of a fixed-size field saved by \c MessageBuilder::Save: its original int or float.
+    */
+    constexpr std::size_t SAVED_VALUE_SIZE = 4;
+
+    static_assert(sizeof(int) == SAVED_VALUE_SIZE && sizeof(float) == SAVED_VALUE_SIZE);
+
+    /**
+     * @brief Resolves \c MessageReplay::Auto for the message ID.
+    */
+    metamod::engine::MessageReplay ResolveReplay(const int msg_id, const metamod::engine::MessageReplay replay)
+    {
+        using metamod::engine::MessageReplay;
+
+        if (replay != MessageReplay::Auto) {
+            return replay;
+        }
+
+        // The handlers of intercepted messages decode the fields.
+        return metamod::engine::IsMessageHooked(msg_id) ? MessageReplay::Fields : MessageReplay::Packed;
+    }
+
+    template <typename T>
+    T ReadSavedValue(const std::uint8_t* const data)
+    {
+        T value{};
+        std::memcpy(&value, data, sizeof(T));
+
+        return value;
+    }
+}
+
+namespace metamod::engine
+{
+    void WritePacked(const std::uint8_t* const data, const std::size_t size)
+    {
+        std::size_t offset = 0;
+
+        for (; offset + 4 <= size; offset += 4) {
+            WriteLong(ReadInt(&data[offset], 4));
+        }
+
+        for (; offset < size; ++offset) {
+            WriteByte(data[offset]);
+        }
+    }
+
+    void WriteSavedMessage(const std::uint8_t* const data, const std::size_t size, const MessageReplay replay)
+    {
+        if (replay == MessageReplay::Packed) {
+            WritePacked(data, size);
+            return;
+        }
+
+        for (std::size_t offset = 0; offset < size;) {
+            const auto type = static_cast<MessageField>(data[offset++]);
+            const auto* const value = &data[offset];
+
+            switch (type) {
+            case MessageField::Byte:
+                engine::WriteByte(ReadSavedValue<int>(value));
+                break;
+
+            case MessageField::Char:
+                engine::WriteChar(ReadSavedValue<int>(value));
+                break;
+
+            case MessageField::Short:
+                engine::WriteShort(ReadSavedValue<int>(value));
+                break;
+
+            case MessageField::Long:
+                engine::WriteLong(ReadSavedValue<int>(value));
+                break;
+
+            case MessageField::Angle:
+                engine::WriteAngle(ReadSavedValue<float>(value));
+                break;
+
+            case MessageField::Coord:
+                engine::WriteCoord(ReadSavedValue<float>(value));
+                break;
+
+            case MessageField::String: {
+                const auto* const text = reinterpret_cast<const char*>(value);
+                engine::WriteString(text);
+                offset += std::strlen(text) + 1;
+                continue;
+            }
+
+            case MessageField::Entity:
+                engine::WriteEntity(ReadSavedValue<int>(value));
+                break;
+            }
+
+            offset += SAVED_VALUE_SIZE;
+        }
+    }
+
+    MessageBuilder& MessageBuilder::WriteString(const char* const value)
+    {
+        const auto length = value != nullptr ? std::strlen(value) : 0;
+
+        if (AddField(MessageField::String, length + 1, 0, 0.0F)) {
+            if (length > 0) {
+                std::memcpy(&data_[size_], value, length);
+            }
+
+            size_ += length;
+            data_[size_++] = 0;
+        }
+
+        return *this;
+    }
+
+    bool MessageBuilder::CheckOverflow() const
+    {
+        if (overflowed_) {
+            AlertMessage(AlertType::Logged, "Message builder: message %d exceeds %d bytes and was not sent.\n", msg_id_,
+                         static_cast<int>(MAX_MESSAGE_SIZE));
+        }
+
+        return !overflowed_;
+    }
+
+    void MessageBuilder::Send(const MessageType msg_type, Edict* const client, const float* const origin,
+                              const MessageReplay replay) const
+    {
+        if (!CheckOverflow()) {
+            return;
+        }
+
+        MessageBegin(msg_type, msg_id_, origin, client);
+        WriteTo(replay);
+        MessageEnd();
+    }
+
+    void MessageBuilder::SendTo(Edict* const* const clients, const std::size_t count, const bool reliable,
+                                const MessageReplay replay) const
+    {
+        const auto msg_type = reliable ? MessageType::One : MessageType::OneUnreliable;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            Send(msg_type, clients[i], nullptr, replay);
+        }
+    }
+
+    void MessageBuilder::SendTo(const ClientMask clients, const bool reliable, const MessageReplay replay) const
+    {
+        if (!CheckOverflow()) {
+            return;
+        }
+
+        MessageMulticast(clients, msg_id_, reliable, [this, replay] {
+            WriteTo(replay);
+        });
+    }
+
+    MessageReplay MessageBuilder::Save(std::vector<std::uint8_t>& buffer, const MessageReplay replay) const
+    {
+        if (ResolveReplay(msg_id_, replay) == MessageReplay::Packed) {
+            buffer.insert(buffer.end(), data_.cbegin(), data_.cbegin() + size_);
+            return MessageReplay::Packed;
+        }
+
+        for (std::size_t i = 0; i < field_count_; ++i) {
+            const auto& field = fields_[i];
+            const auto* const data = &data_[field.offset];
+
+            buffer.push_back(static_cast<std::uint8_t>(field.type));
+
+            // Integer fields are saved with their original value, as the encoded bytes may be truncated.
+            const auto* value = reinterpret_cast<const std::uint8_t*>(&field.int_value);
+
+            switch (field.type) {
+            case MessageField::Angle:
+            case MessageField::Coord:
+                value = reinterpret_cast<const std::uint8_t*>(&field.float_value);
+                break;
+
+            case MessageField::String:
+                buffer.insert(buffer.end(), data, data + std::strlen(reinterpret_cast<const char*>(data)) + 1);
+                continue;
+
+            default:
+                break;
+            }
+
+            buffer.insert(buffer.end(), value, value + SAVED_VALUE_SIZE);
+        }
+
+        return MessageReplay::Fields;
+    }
+
+    void MessageBuilder::WriteTo(const MessageReplay replay) const
+    {
+        if (ResolveReplay(msg_id_, replay) == MessageReplay::Packed) {
+            WritePacked(data_.data(), size_);
+            return;
+        }
+
+        for (std::size_t i = 0; i < field_count_; ++i) {
+            const auto& field = fields_[i];
+            switch (field.type) {
+            case MessageField::Byte:
+                engine::WriteByte(field.int_value);
+                break;
+
+            case MessageField::Char:
+                engine::WriteChar(field.int_value);
+                break;
+
+            case MessageField::Short:
+                engine::WriteShort(field.int_value);
+                break;
+
+            case MessageField::Long:
+                engine::WriteLong(field.int_value);
+                break;
+
+            case MessageField::Angle:
+                engine::WriteAngle(field.float_value);
+                break;
+
+            case MessageField::Coord:
+                engine::WriteCoord(field.float_value);
+                break;
+
+            case MessageField::String:
+                engine::WriteString(reinterpret_cast<const char*>(&data_[field.offset]));
+                break;
+
+            case MessageField::Entity:
+                engine::WriteEntity(field.int_value);
+                break;
+            }
+        }
+    }
+}
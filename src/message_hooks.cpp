@@ -0,0 +1,356 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/message_hooks.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct HandlerEntry
+    {
+        MessageHandler handler{};
+        int priority{};
+    };
+
+    /**
+     * @brief Handlers of the messages, indexed by message ID.
+    */
+    std::array<std::vector<HandlerEntry>, 256> message_handlers{};
+
+    InterceptedMessage intercepted_message{};
+
+    /**
+     * @brief Whether a message is being captured.
+    */
+    bool capturing{};
+
+    /**
+     * @brief Whether the handlers are being called or the captured message is being sent.
+    */
+    bool dispatching{};
+
+    /**
+     * @brief Whether a message too long to be captured is passed through to the engine.
+    */
+    bool passing_through{};
+
+    bool capture_hooked{};
+
+    void OnMessageBegin(const MessageType msg_type, const int msg_id, const float* const origin, Edict* const client)
+    {
+        if (dispatching || msg_id < 0 || msg_id >= static_cast<int>(message_handlers.size()) ||
+            message_handlers[msg_id].empty()) {
+            SetResult(Result::Ignored);
+            return;
+        }
+
+        capturing = true;
+        intercepted_message.Begin(msg_type, msg_id, origin, client);
+        SetResult(Result::Supercede);
+    }
+
+    FORCEINLINE void Capture(const MessageField type, const int int_value, const float float_value, const char* const string_value)
+    {
+        if (!capturing) {
+            SetResult(Result::Ignored);
+            return;
+        }
+
+        if (intercepted_message.Add(type, int_value, float_value, string_value)) {
+            SetResult(Result::Supercede);
+            return;
+        }
+
+        AlertMessage(AlertType::Logged, "Intercept message: message %d is too long to be intercepted; sent unchanged.\n",
+                     intercepted_message.Id());
+
+        // The fields captured so far are forwarded, and this field and the rest of the message go to the engine.
+        capturing = false;
+        dispatching = true;
+        passing_through = true;
+
+        intercepted_message.Forward();
+        SetResult(Result::Ignored);
+    }
+
+    void OnWriteByte(const int value)
+    {
+        Capture(MessageField::Byte, value, 0.0F, nullptr);
+    }
+
+    void OnWriteChar(const int value)
+    {
+        Capture(MessageField::Char, value, 0.0F, nullptr);
+    }
+
+    void OnWriteShort(const int value)
+    {
+        Capture(MessageField::Short, value, 0.0F, nullptr);
+    }
+
+    void OnWriteLong(const int value)
+    {
+        Capture(MessageField::Long, value, 0.0F, nullptr);
+    }
+
+    void OnWriteAngle(const float value)
+    {
+        Capture(MessageField::Angle, 0, value, nullptr);
+    }
+
+    void OnWriteCoord(const float value)
+    {
+        Capture(MessageField::Coord, 0, value, nullptr);
+    }
+
+    void OnWriteString(const char* const value)
+    {
+        Capture(MessageField::String, 0, 0.0F, value);
+    }
+
+    void OnWriteEntity(const int value)
+    {
+        Capture(MessageField::Entity, value, 0.0F, nullptr);
+    }
+
+    void OnMessageEnd()
+    {
+        if (passing_through) {
+            passing_through = false;
+            dispatching = false;
+            SetResult(Result::Ignored);
+            return;
+        }
+
+        if (!capturing) {
+            SetResult(Result::Ignored);
+            return;
+        }
+
+        capturing = false;
+        dispatching = true;
+
+        // Index-based loop: a handler may add handlers.
+        const auto& handlers = message_handlers[intercepted_message.Id()];
+
+        for (std::size_t i = 0; i < handlers.size() && !intercepted_message.Blocked(); ++i) {
+            handlers[i].handler(intercepted_message);
+        }
+
+        if (!intercepted_message.Blocked()) {
+            intercepted_message.Send();
+        }
+
+        dispatching = false;
+        SetResult(Result::Supercede);
+    }
+
+    /**
+     * @brief Installs the capture hooks; they are called before any other message hook of this plugin.
+     * Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+    */
+    void InstallCaptureHooks()
+    {
+        if (capture_hooked) {
+            return;
+        }
+
+        capture_hooked = true;
+
+        metamod::detail::SetInternalHook<&EngineFunctions::message_begin>(&OnMessageBegin, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_byte>(&OnWriteByte, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_char>(&OnWriteChar, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_short>(&OnWriteShort, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_long>(&OnWriteLong, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_angle>(&OnWriteAngle, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_coord>(&OnWriteCoord, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_string>(&OnWriteString, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_entity>(&OnWriteEntity, false, INT_MAX);
+        metamod::detail::SetInternalHook<&EngineFunctions::message_end>(&OnMessageEnd, false, INT_MAX);
+    }
+}
+
+namespace metamod::engine
+{
+    void InterceptedMessage::Begin(const MessageType msg_type, const int msg_id, const float* const origin, Edict* const client)
+    {
+        msg_type_ = msg_type;
+        msg_id_ = msg_id;
+        has_origin_ = origin != nullptr;
+        client_ = client;
+        blocked_ = false;
+        count_ = 0;
+        strings_size_ = 0;
+
+        if (origin != nullptr) {
+            std::copy_n(origin, 3, origin_.begin());
+        }
+    }
+
+    bool InterceptedMessage::Add(const MessageField type, const int int_value, const float float_value,
+                                 const char* const string_value)
+    {
+        if (count_ >= fields_.size()) {
+            return false;
+        }
+
+        auto& field = fields_[count_];
+        field = Field{type, int_value, float_value, nullptr};
+
+        if (type == MessageField::String && (field.string_value = CopyString(string_value)) == nullptr) {
+            return false;
+        }
+
+        ++count_;
+        return true;
+    }
+
+    bool InterceptedMessage::SetString(const std::size_t index, const char* const value)
+    {
+        const auto* const copy = CopyString(value);
+
+        if (copy == nullptr) {
+            return false;
+        }
+
+        fields_[index].string_value = copy;
+        return true;
+    }
+
+    const char* InterceptedMessage::CopyString(const char* const value)
+    {
+        const auto length = value != nullptr ? std::strlen(value) : 0;
+
+        if (strings_size_ + length + 1 > strings_.size()) {
+            return nullptr;
+        }
+
+        auto* const copy = &strings_[strings_size_];
+
+        if (length > 0) {
+            std::memcpy(copy, value, length);
+        }
+
+        copy[length] = '\0';
+        strings_size_ += length + 1;
+
+        return copy;
+    }
+
+    void InterceptedMessage::Send() const
+    {
+        Forward();
+        MessageEnd();
+    }
+
+    void InterceptedMessage::Forward() const
+    {
+        MessageBegin(msg_type_, msg_id_, Origin(), client_);
+
+        for (std::size_t i = 0; i < count_; ++i) {
+            const auto& field = fields_[i];
+
+            switch (field.type) {
+            case MessageField::Byte:
+                WriteByte(field.int_value);
+                break;
+
+            case MessageField::Char:
+                WriteChar(field.int_value);
+                break;
+
+            case MessageField::Short:
+                WriteShort(field.int_value);
+                break;
+
+            case MessageField::Long:
+                WriteLong(field.int_value);
+                break;
+
+            case MessageField::Angle:
+                WriteAngle(field.float_value);
+                break;
+
+            case MessageField::Coord:
+                WriteCoord(field.float_value);
+                break;
+
+            case MessageField::String:
+                WriteString(field.string_value);
+                break;
+
+            case MessageField::Entity:
+                WriteEntity(field.int_value);
+                break;
+            }
+        }
+    }
+
+    void HookMessage(const int msg_id, const MessageHandler handler, const int priority)
+    {
+        if (msg_id < 0 || msg_id >= static_cast<int>(message_handlers.size())) {
+            AlertMessage(AlertType::Logged, "Hook message: invalid message id %d.\n", msg_id);
+            return;
+        }
+
+        auto& handlers = message_handlers[msg_id];
+
+        if (handler == nullptr) {
+            handlers.clear();
+            return;
+        }
+
+        UnhookMessage(msg_id, handler);
+
+        // Handlers of equal priority keep their registration order.
+        const auto pos = std::find_if(handlers.cbegin(), handlers.cend(), [priority](const HandlerEntry& entry) {
+            return entry.priority < priority;
+        });
+
+        handlers.insert(pos, HandlerEntry{handler, priority});
+        InstallCaptureHooks();
+    }
+
+    void UnhookMessage(const int msg_id, const MessageHandler handler)
+    {
+        if (msg_id < 0 || msg_id >= static_cast<int>(message_handlers.size())) {
+            return;
+        }
+
+        auto& handlers = message_handlers[msg_id];
+
+        handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [handler](const HandlerEntry& entry) {
+            return entry.handler == handler;
+        }), handlers.end());
+    }
+
+    bool IsMessageHooked(const int msg_id)
+    {
+        return msg_id >= 0 && msg_id < static_cast<int>(message_handlers.size()) && !message_handlers[msg_id].empty();
+    }
+}
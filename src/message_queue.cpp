@@ -0,0 +1,219 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/message_queue.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <metamod/multicast.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct QueuedMessage
+    {
+        int priority{};
+        std::uint32_t sequence{};
+        int msg_id{};
+        bool reliable{};
+        MessageReplay replay{};
+
+        /**
+         * @brief Size of the encoded message, in bytes.
+        */
+        std::size_t size{};
+
+        /**
+         * @brief The message saved with \c MessageBuilder::Save.
+        */
+        std::vector<std::uint8_t> data{};
+    };
+
+    /**
+     * @brief Heap order: higher priority first, then lower sequence number first.
+    */
+    bool SentLater(const QueuedMessage& lhs, const QueuedMessage& rhs)
+    {
+        return lhs.priority != rhs.priority ? lhs.priority < rhs.priority : lhs.sequence > rhs.sequence;
+    }
+
+    /**
+     * @brief Message queues indexed by the entity index of the client (1 to 64), each a heap.
+    */
+    std::array<std::vector<QueuedMessage>, 65> message_queues{};
+
+    /**
+     * @brief Buffers of sent messages, reused for new messages.
+    */
+    std::vector<std::vector<std::uint8_t>> spare_buffers{};
+
+    std::size_t message_budget = DEFAULT_MESSAGE_BUDGET;
+    std::uint32_t next_sequence{};
+    bool queue_hooked{};
+
+    void Recycle(QueuedMessage& message)
+    {
+        message.data.clear();
+        spare_buffers.push_back(std::move(message.data));
+    }
+
+    void DropQueue(std::vector<QueuedMessage>& queue)
+    {
+        for (auto& message : queue) {
+            Recycle(message);
+        }
+
+        queue.clear();
+    }
+
+    void Enqueue(const int client_index, const MessageBuilder& message, const int priority, const bool reliable,
+                 const MessageReplay replay)
+    {
+        QueuedMessage entry{priority, next_sequence++, message.MsgId(), reliable, replay, message.Size(), {}};
+
+        if (!spare_buffers.empty()) {
+            entry.data = std::move(spare_buffers.back());
+            spare_buffers.pop_back();
+        }
+
+        entry.replay = message.Save(entry.data, replay);
+
+        auto& queue = message_queues[client_index];
+        queue.push_back(std::move(entry));
+        std::push_heap(queue.begin(), queue.end(), SentLater);
+    }
+
+    void Drain(const int client_index, std::vector<QueuedMessage>& queue)
+    {
+        auto* const client = EntityOfEntIndex(client_index);
+
+        if (client == nullptr || client->free || !(client->vars.flags & FL_CLIENT)) {
+            DropQueue(queue);
+            return;
+        }
+
+        std::size_t spent = 0;
+
+        while (!queue.empty()) {
+            // The size of a message includes one byte for its ID.
+            const auto cost = queue.front().size + 1;
+
+            if (spent > 0 && spent + cost > message_budget) {
+                break;
+            }
+
+            std::pop_heap(queue.begin(), queue.end(), SentLater);
+            auto& message = queue.back();
+
+            MessageBegin(message.reliable ? MessageType::One : MessageType::OneUnreliable, message.msg_id, nullptr, client);
+            WriteSavedMessage(message.data.data(), message.data.size(), message.replay);
+            MessageEnd();
+
+            spent += cost;
+            Recycle(message);
+            queue.pop_back();
+        }
+    }
+
+    void OnStartFrame()
+    {
+        for (auto index = 1; index < static_cast<int>(message_queues.size()); ++index) {
+            if (auto& queue = message_queues[index]; !queue.empty()) {
+                Drain(index, queue);
+            }
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The next client in the slot must not receive the messages queued for this one.
+    */
+    void OnClientDisconnect(Edict* const client)
+    {
+        if (const auto index = IndexOfEdict(client); index > 0 && static_cast<std::size_t>(index) < message_queues.size()) {
+            DropQueue(message_queues[index]);
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    void OnServerDeactivate()
+    {
+        for (auto& queue : message_queues) {
+            DropQueue(queue);
+        }
+
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::engine
+{
+    void QueueMessage(const MessageBuilder& message, Edict* const client, const int priority, const bool reliable,
+                      const MessageReplay replay)
+    {
+        if (message.Overflowed()) {
+            AlertMessage(AlertType::Logged, "Queue message: message %d exceeds %d bytes and was not queued.\n", message.MsgId(),
+                         static_cast<int>(MAX_MESSAGE_SIZE));
+            return;
+        }
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        if (!queue_hooked) {
+            queue_hooked = true;
+            metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false);
+            metamod::detail::SetInternalHook<&DllFunctions::client_disconnect>(&OnClientDisconnect, false);
+            metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivate, false);
+        }
+
+        if (client != nullptr) {
+            if (const auto index = IndexOfEdict(client); index > 0 && static_cast<std::size_t>(index) < message_queues.size()) {
+                Enqueue(index, message, priority, reliable, replay);
+            }
+
+            return;
+        }
+
+        for (auto clients = ReceivingClients(); clients != 0; clients &= clients - 1) {
+            Enqueue(LowestClient(clients), message, priority, reliable, replay);
+        }
+    }
+
+    void SetMessageBudget(const std::size_t bytes_per_frame)
+    {
+        message_budget = bytes_per_frame;
+    }
+
+    std::size_t QueuedMessages(const int client_index)
+    {
+        if (client_index <= 0 || static_cast<std::size_t>(client_index) >= message_queues.size()) {
+            return 0;
+        }
+
+        return message_queues[client_index].size();
+    }
+}
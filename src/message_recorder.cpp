@@ -0,0 +1,409 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/message_recorder.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <metamod/message_builder.h>
+#include <metamod/utils.h>
+#include <climits>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    /**
+     * @brief Size of a record buffer; a full buffer is handed to the writer before the next frame starts.
+    */
+    constexpr std::size_t RECORDER_BUFFER_SIZE = 256 * 1024;
+
+    /**
+     * @brief Maximum number of bytes waiting for the writer; records submitted beyond it are dropped.
+    */
+    constexpr std::size_t MAX_PENDING_BYTES = 16 * 1024 * 1024;
+
+    struct Buffer
+    {
+        std::vector<std::uint8_t> data{};
+        std::uint32_t records{};
+    };
+
+    struct MessageRecorder
+    {
+        std::FILE* file{};
+        std::thread writer{};
+        std::mutex mutex{};
+        std::condition_variable wake{};
+
+        /**
+         * @brief Signalled when the writer has written the last buffer and leaves its loop.
+        */
+        std::condition_variable done{};
+
+        /**
+         * @brief Buffers waiting for the writer, oldest first (guarded by \c mutex).
+        */
+        std::vector<Buffer> pending{};
+
+        /**
+         * @brief Written buffers whose memory is reused (guarded by \c mutex).
+        */
+        std::vector<Buffer> spare{};
+
+        std::size_t pending_bytes{};
+        bool stopping{};
+        bool stopped{};
+
+        /**
+         * @brief Buffer the messages of the current frame are recorded into (game thread only).
+        */
+        Buffer active{};
+
+        std::uint64_t dropped{};
+        std::uint32_t frame{};
+
+        /**
+         * @brief Offset of the header of the message being recorded in the active buffer.
+        */
+        std::size_t record_offset{};
+
+        std::uint16_t field_count{};
+        bool recording{};
+
+        ~MessageRecorder()
+        {
+            // Meta_Detach stops the recorder. If it was not stopped, the remaining records are still written and the
+            // file is closed, but the writer is not joined: that would deadlock on the Windows loader lock.
+            // It no longer uses the recorder once it has signalled \c done.
+            if (writer.joinable()) {
+                DrainWriter();
+                writer.detach();
+                std::fclose(file);
+            }
+        }
+
+        void WriterLoop()
+        {
+            std::unique_lock lock{mutex};
+
+            while (true) {
+                wake.wait(lock, [this] { return stopping || !pending.empty(); });
+
+                if (pending.empty()) {
+                    stopped = true;
+                    done.notify_one();
+                    break;
+                }
+
+                auto buffer = std::move(pending.front());
+                pending.erase(pending.begin());
+
+                lock.unlock();
+                std::fwrite(buffer.data.data(), 1, buffer.data.size(), file);
+                std::fflush(file);
+                lock.lock();
+
+                pending_bytes -= buffer.data.size();
+                buffer.data.clear();
+                buffer.records = 0;
+                spare.push_back(std::move(buffer));
+            }
+        }
+
+        /**
+         * @brief Hands the active buffer to the writer and takes a spare one.
+        */
+        void Submit()
+        {
+            if (active.data.empty()) {
+                return;
+            }
+
+            {
+                const std::lock_guard lock{mutex};
+
+                if (pending_bytes + active.data.size() > MAX_PENDING_BYTES) {
+                    dropped += active.records;
+                }
+                else {
+                    pending_bytes += active.data.size();
+                    pending.push_back(std::move(active));
+
+                    if (spare.empty()) {
+                        active = {};
+                    }
+                    else {
+                        active = std::move(spare.back());
+                        spare.pop_back();
+                    }
+                }
+            }
+
+            wake.notify_one();
+            active.data.clear();
+            active.records = 0;
+            active.data.reserve(RECORDER_BUFFER_SIZE);
+        }
+
+        /**
+         * @brief Hands the last records to the writer and waits until it has written all buffers and left its loop.
+        */
+        void DrainWriter()
+        {
+            if (recording) {
+                active.data.resize(record_offset);
+                recording = false;
+            }
+
+            Submit();
+
+            std::unique_lock lock{mutex};
+            stopping = true;
+            wake.notify_one();
+            done.wait(lock, [this] { return stopped; });
+        }
+
+        void StopWriter()
+        {
+            if (file == nullptr) {
+                return;
+            }
+
+            DrainWriter();
+            writer.join();
+
+            std::fclose(file);
+            file = nullptr;
+            pending.clear();
+            spare.clear();
+            active = {};
+        }
+    };
+
+    MessageRecorder recorder{};
+
+    template <typename T>
+    FORCEINLINE void Append(const T& value)
+    {
+        const auto* const bytes = reinterpret_cast<const std::uint8_t*>(&value);
+        recorder.active.data.insert(recorder.active.data.end(), bytes, bytes + sizeof(T));
+    }
+
+    FORCEINLINE void AppendField(const MessageField type)
+    {
+        Append(static_cast<std::uint8_t>(type));
+        ++recorder.field_count;
+        SetResult(Result::Ignored);
+    }
+
+    void OnMessageBegin(const MessageType msg_type, const int msg_id, const float* const origin, Edict* const client)
+    {
+        SetResult(Result::Ignored);
+
+        MessageRecordHeader header{};
+        header.frame = recorder.frame;
+        header.time = Time();
+        header.msg_id = static_cast<std::int16_t>(msg_id);
+        header.msg_type = static_cast<std::uint8_t>(msg_type);
+        header.client = static_cast<std::int16_t>(client != nullptr ? IndexOfEdict(client) : -1);
+
+        if (origin != nullptr) {
+            header.has_origin = 1;
+            std::memcpy(header.origin, origin, sizeof header.origin);
+        }
+
+        recorder.record_offset = recorder.active.data.size();
+        recorder.field_count = 0;
+        recorder.recording = true;
+        Append(header);
+    }
+
+    void OnWriteByte(const int value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Byte);
+            Append(static_cast<std::uint8_t>(value));
+        }
+    }
+
+    void OnWriteChar(const int value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Char);
+            Append(static_cast<std::int8_t>(value));
+        }
+    }
+
+    void OnWriteShort(const int value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Short);
+            Append(static_cast<std::int16_t>(value));
+        }
+    }
+
+    void OnWriteLong(const int value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Long);
+            Append(static_cast<std::int32_t>(value));
+        }
+    }
+
+    void OnWriteAngle(const float value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Angle);
+            Append(value);
+        }
+    }
+
+    void OnWriteCoord(const float value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Coord);
+            Append(value);
+        }
+    }
+
+    void OnWriteString(const char* const value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::String);
+            const auto* const string = value != nullptr ? value : "";
+            recorder.active.data.insert(recorder.active.data.end(), string, string + std::strlen(string) + 1);
+        }
+    }
+
+    void OnWriteEntity(const int value)
+    {
+        if (recorder.recording) {
+            AppendField(MessageField::Entity);
+            Append(static_cast<std::int16_t>(value));
+        }
+    }
+
+    void OnMessageEnd()
+    {
+        SetResult(Result::Ignored);
+
+        if (!recorder.recording) {
+            return;
+        }
+
+        recorder.recording = false;
+
+        auto& data = recorder.active.data;
+        data.resize((data.size() + 3) & ~std::size_t{3});
+
+        auto* const header = reinterpret_cast<MessageRecordHeader*>(data.data() + recorder.record_offset);
+        header->size = static_cast<std::uint32_t>(data.size() - recorder.record_offset);
+        header->field_count = recorder.field_count;
+        ++recorder.active.records;
+
+        if (data.size() >= RECORDER_BUFFER_SIZE) {
+            recorder.Submit();
+        }
+    }
+
+    void OnStartFrame()
+    {
+        SetResult(Result::Ignored);
+
+        recorder.Submit();
+        ++recorder.frame;
+    }
+}
+
+namespace metamod::engine
+{
+    bool StartMessageRecorder(const char* const path)
+    {
+        StopMessageRecorder();
+
+        recorder.file = std::fopen(path, "wb");
+
+        if (recorder.file == nullptr) {
+            AlertMessage(AlertType::Logged, "Failed to open the message recording file \"%s\".\n", path);
+            return false;
+        }
+
+        const MessageRecordingHeader header{};
+        std::fwrite(&header, sizeof header, 1, recorder.file);
+
+        recorder.stopping = false;
+        recorder.stopped = false;
+        recorder.pending_bytes = 0;
+        recorder.dropped = 0;
+        recorder.frame = 0;
+        recorder.recording = false;
+        recorder.active.data.reserve(RECORDER_BUFFER_SIZE);
+        recorder.writer = std::thread{&MessageRecorder::WriterLoop, &recorder};
+
+        metamod::detail::SetInternalHook<&EngineFunctions::message_begin>(&OnMessageBegin, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_byte>(&OnWriteByte, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_char>(&OnWriteChar, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_short>(&OnWriteShort, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_long>(&OnWriteLong, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_angle>(&OnWriteAngle, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_coord>(&OnWriteCoord, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_string>(&OnWriteString, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::write_entity>(&OnWriteEntity, false, INT_MIN);
+        metamod::detail::SetInternalHook<&EngineFunctions::message_end>(&OnMessageEnd, false, INT_MIN);
+
+        metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false, INT_MAX);
+
+        return true;
+    }
+
+    void StopMessageRecorder()
+    {
+        if (recorder.file == nullptr) {
+            return;
+        }
+
+        RemoveHook<&EngineFunctions::message_begin>(OnMessageBegin, false);
+        RemoveHook<&EngineFunctions::write_byte>(OnWriteByte, false);
+        RemoveHook<&EngineFunctions::write_char>(OnWriteChar, false);
+        RemoveHook<&EngineFunctions::write_short>(OnWriteShort, false);
+        RemoveHook<&EngineFunctions::write_long>(OnWriteLong, false);
+        RemoveHook<&EngineFunctions::write_angle>(OnWriteAngle, false);
+        RemoveHook<&EngineFunctions::write_coord>(OnWriteCoord, false);
+        RemoveHook<&EngineFunctions::write_string>(OnWriteString, false);
+        RemoveHook<&EngineFunctions::write_entity>(OnWriteEntity, false);
+        RemoveHook<&EngineFunctions::message_end>(OnMessageEnd, false);
+        RemoveHook<&DllFunctions::start_frame>(OnStartFrame, false);
+
+        recorder.StopWriter();
+
+        if (recorder.dropped > 0) {
+            AlertMessage(AlertType::Logged, "Message recorder: %llu records were dropped because the disk was too slow.\n",
+                         static_cast<unsigned long long>(recorder.dropped));
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/multicast.h>
+#include <metamod/player_roster.h>
+
+using namespace cssdk;
+
+namespace metamod::engine
+{
+    ClientMask ReceivingClients()
+    {
+        ClientMask clients{};
+
+        // The roster holds only the connected players, so the free client slots are not looked up.
+        for (const auto& player : gamedll::Roster()) {
+            const auto& vars = player.edict->vars;
+
+            if (player.index <= 64 && !player.edict->free && (vars.flags & FL_CLIENT) && !(vars.flags & FL_FAKE_CLIENT)) {
+                clients |= ClientBit(player.index);
+            }
+        }
+
+        return clients;
+    }
+}
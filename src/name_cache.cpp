@@ -0,0 +1,173 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/name_cache.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <metamod/utils.h>
+#include <array>
+#include <cassert>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    struct CachedName
+    {
+        std::int64_t index{};
+        int size{};
+
+        /**
+         * @brief Value of \c name_cache_generation when the name was resolved.
+        */
+        std::uint32_t generation{};
+    };
+
+    /**
+     * @brief Interned names, indexed by \c NameId.
+    */
+    std::vector<std::string> interned_names{};
+
+    /**
+     * @brief IDs of the interned names; only used when a name is interned.
+    */
+    std::unordered_map<std::string, NameId> name_ids{};
+
+    /**
+     * @brief Resolved names indexed by \c NameId, one array per \c NameKind.
+    */
+    std::array<std::vector<CachedName>, 5> name_cache{};
+
+    bool name_cache_hooked{};
+
+    void OnServerDeactivate()
+    {
+        // Every cached name of an older generation is resolved again on its next lookup.
+        ++engine::detail::name_cache_generation;
+        SetResult(Result::Ignored);
+    }
+
+    std::int64_t Lookup(const NameKind kind, const NameId id, int* const size)
+    {
+        assert(id < interned_names.size());
+        auto& names = name_cache[static_cast<std::size_t>(kind)];
+
+        if (id >= names.size()) {
+            names.resize(interned_names.size());
+        }
+
+        auto& entry = names[id];
+
+        if (entry.generation != engine::detail::name_cache_generation &&
+            engine::detail::ResolveName(kind, interned_names[id].c_str(), entry.index, &entry.size)) {
+            entry.generation = engine::detail::name_cache_generation;
+        }
+
+        if (size != nullptr) {
+            *size = entry.size;
+        }
+
+        return entry.index;
+    }
+}
+
+namespace metamod::engine::detail
+{
+    void InstallNameCacheHooks()
+    {
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so it is installed once.
+        if (!name_cache_hooked) {
+            name_cache_hooked = true;
+            metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivate, true);
+        }
+    }
+
+    bool ResolveName(const NameKind kind, const char* const name, std::int64_t& index, int* const size)
+    {
+        InstallNameCacheHooks();
+
+        switch (kind) {
+        case NameKind::Model:
+            index = ModelIndex(name);
+            return true;
+
+        case NameKind::Decal:
+            index = DecalIndex(name);
+            return index >= 0;
+
+        case NameKind::Function:
+            index = FunctionFromName(name);
+            return index != 0;
+
+        case NameKind::UserMessage:
+            index = utils::GetUserMsgId(name, size);
+            return index > 0;
+
+        case NameKind::Event:
+            index = PrecacheEvent(1, name);
+            return index != 0;
+        }
+
+        return false;
+    }
+}
+
+namespace metamod::engine
+{
+    NameId InternName(const char* const name)
+    {
+        const auto [it, inserted] = name_ids.try_emplace(name != nullptr ? name : "", static_cast<NameId>(interned_names.size()));
+
+        if (inserted) {
+            interned_names.push_back(it->first);
+        }
+
+        return it->second;
+    }
+
+    int CachedModelIndex(const NameId model)
+    {
+        return static_cast<int>(Lookup(NameKind::Model, model, nullptr));
+    }
+
+    int CachedDecalIndex(const NameId name)
+    {
+        return static_cast<int>(Lookup(NameKind::Decal, name, nullptr));
+    }
+
+    uint32 CachedFunctionFromName(const NameId name)
+    {
+        return static_cast<uint32>(Lookup(NameKind::Function, name, nullptr));
+    }
+
+    int CachedUserMsgId(const NameId name, int* const size)
+    {
+        return static_cast<int>(Lookup(NameKind::UserMessage, name, size));
+    }
+
+    unsigned short CachedPrecacheEvent(const NameId path)
+    {
+        return static_cast<unsigned short>(Lookup(NameKind::Event, path, nullptr));
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/player_batch.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::gamedll;
+
+namespace
+{
+    /**
+     * @brief Players collected from a hook slot during the current frame.
+    */
+    struct PlayerBatch
+    {
+        std::vector<PlayerBatchCallback> callbacks{};
+        std::vector<Edict*> players{};
+
+        /**
+         * @brief Frame in which the player with the given index was last recorded.
+        */
+        std::vector<std::uint32_t> recorded_frames{};
+
+        std::uint32_t frame{1};
+
+        /**
+         * @brief Whether the hook collecting the players is installed.
+        */
+        bool hooked{};
+    };
+
+    PlayerBatch pre_think_batch{};
+    PlayerBatch post_think_batch{};
+
+    /**
+     * @brief Whether the hooks delivering the batches are installed.
+    */
+    bool flush_hooked{};
+
+    FORCEINLINE void Collect(PlayerBatch& batch, Edict* const client)
+    {
+        const auto index = engine::IndexOfEdict(client);
+
+        if (index < 0) {
+            return;
+        }
+
+        if (static_cast<std::size_t>(index) >= batch.recorded_frames.size()) {
+            batch.recorded_frames.resize(static_cast<std::size_t>(index) + 1);
+        }
+
+        if (batch.recorded_frames[index] != batch.frame) {
+            batch.recorded_frames[index] = batch.frame;
+            batch.players.push_back(client);
+        }
+    }
+
+    void Flush(PlayerBatch& batch)
+    {
+        if (!batch.players.empty()) {
+            // Index-based loop: a callback may add batch callbacks.
+            for (std::size_t i = 0; i < batch.callbacks.size(); ++i) {
+                batch.callbacks[i](batch.players.data(), batch.players.size());
+            }
+
+            batch.players.clear();
+        }
+
+        ++batch.frame;
+    }
+
+    void OnPlayerPreThinkPost(Edict* const client)
+    {
+        Collect(pre_think_batch, client);
+        SetResult(Result::Ignored);
+    }
+
+    void OnPlayerPostThinkPost(Edict* const client)
+    {
+        Collect(post_think_batch, client);
+        SetResult(Result::Ignored);
+    }
+
+    void FlushPlayerBatches()
+    {
+        Flush(pre_think_batch);
+        Flush(post_think_batch);
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief Adds the callback to the batch, or removes all its callbacks if \c callback is \c nullptr,
+     * and installs the hooks that are needed while any batch has callbacks.
+    */
+    template <auto Member>
+    void SetBatchCallback(PlayerBatch& batch, const PlayerBatchCallback callback, void (*const collect)(Edict*))
+    {
+        if (callback == nullptr) {
+            batch.callbacks.clear();
+            batch.players.clear();
+        }
+        else if (std::find(batch.callbacks.cbegin(), batch.callbacks.cend(), callback) == batch.callbacks.cend()) {
+            batch.callbacks.push_back(callback);
+        }
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        if (batch.callbacks.empty() == batch.hooked) {
+            batch.hooked = !batch.hooked;
+
+            if (batch.hooked) {
+                metamod::detail::SetInternalHook<Member>(collect, true);
+            }
+            else {
+                metamod::detail::RemoveSlotHook<Member>(collect, true);
+            }
+        }
+
+        const auto has_callbacks = !pre_think_batch.callbacks.empty() || !post_think_batch.callbacks.empty();
+
+        if (has_callbacks != flush_hooked) {
+            flush_hooked = has_callbacks;
+
+            if (flush_hooked) {
+                // Deliver the previous frame before any other StartFrame hook of this plugin runs.
+                metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&FlushPlayerBatches, false, INT_MAX);
+                metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&FlushPlayerBatches, false, INT_MAX);
+            }
+            else {
+                metamod::detail::RemoveSlotHook<&DllFunctions::start_frame>(&FlushPlayerBatches, false);
+                metamod::detail::RemoveSlotHook<&DllFunctions::server_deactivate>(&FlushPlayerBatches, false);
+            }
+        }
+    }
+}
+
+namespace metamod::gamedll
+{
+    void HookPlayerPreThinkBatch(const PlayerBatchCallback callback)
+    {
+        SetBatchCallback<&DllFunctions::player_pre_think>(pre_think_batch, callback, &OnPlayerPreThinkPost);
+    }
+
+    void HookPlayerPostThinkBatch(const PlayerBatchCallback callback)
+    {
+        SetBatchCallback<&DllFunctions::player_post_think>(post_think_batch, callback, &OnPlayerPostThinkPost);
+    }
+}
@@ -0,0 +1,211 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/player_roster.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::gamedll;
+using namespace metamod::gamedll::detail;
+
+namespace
+{
+    /**
+     * @brief Position of a free slot in \c roster_positions.
+    */
+    constexpr auto NO_POSITION = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Whether a client may have been put in the server without the hooks since the last frame.
+    */
+    bool scan_pending{};
+
+    void Resize(const int max_clients)
+    {
+        if (max_clients >= 0 && roster_positions.size() < static_cast<std::size_t>(max_clients) + 1) {
+            roster_positions.resize(static_cast<std::size_t>(max_clients) + 1, NO_POSITION);
+        }
+    }
+
+    void SetState(Edict* const client, const PlayerState state)
+    {
+        const auto index = engine::IndexOfEdict(client);
+
+        if (index <= 0) {
+            return;
+        }
+
+        Resize(index);
+        auto& position = roster_positions[index];
+
+        if (state == PlayerState::Free) {
+            if (position != NO_POSITION) {
+                // Swap with the last player, so the roster stays dense.
+                const auto& last = roster_players.back();
+                roster_positions[last.index] = position;
+                roster_players[position] = last;
+                roster_players.pop_back();
+                position = NO_POSITION;
+            }
+        }
+        else if (position == NO_POSITION) {
+            position = roster_players.size();
+            roster_players.push_back(RosterPlayer{client, index, state});
+        }
+        else {
+            roster_players[position].state = state;
+        }
+    }
+
+    /**
+     * @brief Adds the clients that are in the server but not in the roster, e.g. bots put in the server
+     * by the game DLL or by other plugins without the \c ClientPutInServer hook.
+    */
+    void AddMissingPlayers()
+    {
+        Resize(g_global_vars->max_clients);
+
+        for (auto index = 1; index <= g_global_vars->max_clients; ++index) {
+            auto* const client = engine::EntityOfEntIndex(index);
+
+            if (client == nullptr || client->free || !(client->vars.flags & FL_CLIENT)) {
+                continue;
+            }
+
+            if (const auto position = roster_positions[index]; position == NO_POSITION) {
+                SetState(client, PlayerState::InGame);
+            }
+            else if ((client->vars.flags & FL_FAKE_CLIENT) && roster_players[position].state == PlayerState::Connected) {
+                // Bots do not load resources; they are in game as soon as they are created.
+                roster_players[position].state = PlayerState::InGame;
+            }
+        }
+    }
+
+    qboolean OnClientConnectPost(Edict* const client, const char* /*name*/, const char* /*address*/,
+                                 char* /*reject_reason*/)
+    {
+        if (GetRetValue<qboolean>()) {
+            SetState(client, PlayerState::Connected);
+        }
+
+        SetResult(Result::Ignored);
+        return 0;
+    }
+
+    void OnClientPutInServerPost(Edict* const client)
+    {
+        SetState(client, PlayerState::InGame);
+        SetResult(Result::Ignored);
+    }
+
+    void OnClientDisconnectPost(Edict* const client)
+    {
+        SetState(client, PlayerState::Free);
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The bots of the previous map may be put in the server again without the hooks.
+    */
+    void OnServerActivatePost(Edict* /*edict_list*/, const int /*edict_count*/, const int client_max)
+    {
+        Resize(client_max);
+        AddMissingPlayers();
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The bot is put in the server right after it is created, so it is added on the next frame.
+    */
+    Edict* OnCreateFakeClientPost(const char* /*name*/)
+    {
+        scan_pending = true;
+        SetResult(Result::Ignored);
+
+        return nullptr;
+    }
+
+    void OnStartFramePost()
+    {
+        if (scan_pending) {
+            scan_pending = false;
+            AddMissingPlayers();
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The clients stay connected across a map change and are put in the server again.
+    */
+    void OnServerDeactivatePost()
+    {
+        for (auto& player : roster_players) {
+            player.state = PlayerState::Connected;
+        }
+
+        SetResult(Result::Ignored);
+    }
+}
+
+namespace metamod::gamedll::detail
+{
+    void StartRoster()
+    {
+        roster_started = true;
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        metamod::detail::SetInternalHook<&DllFunctions::client_connect>(&OnClientConnectPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::client_put_in_server>(&OnClientPutInServerPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::client_disconnect>(&OnClientDisconnectPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::server_activate>(&OnServerActivatePost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivatePost, true);
+        metamod::detail::SetInternalHook<&EngineFunctions::create_fake_client>(&OnCreateFakeClientPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFramePost, true);
+
+        AddMissingPlayers();
+    }
+}
+
+namespace metamod::gamedll
+{
+    std::size_t CountPlayers(const PlayerFilter& filter)
+    {
+        std::size_t count{};
+        ForEachPlayer(filter, [&count](Edict* /*player*/) { ++count; });
+
+        return count;
+    }
+
+    PlayerState GetPlayerState(const int index)
+    {
+        Roster();
+
+        if (index <= 0 || static_cast<std::size_t>(index) >= roster_positions.size() ||
+            roster_positions[index] == NO_POSITION) {
+            return PlayerState::Free;
+        }
+
+        return roster_players[roster_positions[index]].state;
+    }
+}
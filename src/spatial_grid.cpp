@@ -0,0 +1,410 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <metamod/spatial_grid.h>
+#include <metamod/api.h>
+#include <metamod/engine.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    /**
+     * @brief Cell of the entities wider than two cells; it is visited by every query.
+    */
+    constexpr int OVERSIZED_CELL = GRID_CELLS_PER_AXIS * GRID_CELLS_PER_AXIS;
+
+    /**
+     * @brief Position of an entity in the grid.
+    */
+    struct GridEntity
+    {
+        int cell{-1};
+        std::size_t position{};
+
+        /**
+         * @brief Whether the entity is in \c SpatialGrid::moving.
+        */
+        bool moving{};
+    };
+
+    struct SpatialGrid
+    {
+        std::vector<std::vector<Edict*>> cells{};
+
+        /**
+         * @brief Entities by \c IndexOfEdict.
+        */
+        std::vector<GridEntity> entities{};
+
+        /**
+         * @brief Indices of the entities with a move type, which the physics moves without a \c SetOrigin call.
+        */
+        std::vector<int> moving{};
+
+        /**
+         * @brief Entities created or spawned since the last reconciliation.
+        */
+        std::vector<Edict*> pending{};
+
+        /**
+         * @brief Distance an entity may have moved since the last reconciliation.
+        */
+        float movement_slack{};
+
+        /**
+         * @brief Largest distance from the center of an entity in the cells to the edge of its absolute bounds.
+        */
+        float max_half_extent{};
+
+        bool indexing{};
+    };
+
+    SpatialGrid grid{};
+
+    FORCEINLINE int AxisCell(const float value)
+    {
+        const auto cell = static_cast<int>(std::floor((value + GRID_WORLD_EXTENT) / GRID_CELL_SIZE));
+        return std::clamp(cell, 0, GRID_CELLS_PER_AXIS - 1);
+    }
+
+    FORCEINLINE Vector Center(const EntityVars& vars)
+    {
+        return {vars.origin.x + (vars.min_size.x + vars.max_size.x) * 0.5F,
+                vars.origin.y + (vars.min_size.y + vars.max_size.y) * 0.5F,
+                vars.origin.z + (vars.min_size.z + vars.max_size.z) * 0.5F};
+    }
+
+    int CellOf(const EntityVars& vars)
+    {
+        if (vars.max_size.x - vars.min_size.x > 2.F * GRID_CELL_SIZE ||
+            vars.max_size.y - vars.min_size.y > 2.F * GRID_CELL_SIZE) {
+            return OVERSIZED_CELL;
+        }
+
+        const auto center = Center(vars);
+        return AxisCell(center.y) * GRID_CELLS_PER_AXIS + AxisCell(center.x);
+    }
+
+    FORCEINLINE bool IsLive(const Edict* const entity)
+    {
+        return !entity->free && entity->private_data != nullptr;
+    }
+
+    /**
+     * @brief Whether a query may return the entity; \c FindEntityInSphere skips the entities without a class name too.
+    */
+    FORCEINLINE bool IsFindable(const Edict* const entity)
+    {
+        return IsLive(entity) && entity->vars.classname != 0;
+    }
+
+    /**
+     * @brief Distance from the center of the entity to the edge of its absolute bounds on the X and Y axes;
+     * the engine adds a unit to every side of the absolute bounds.
+    */
+    FORCEINLINE float HalfExtent(const EntityVars& vars)
+    {
+        return std::max(vars.max_size.x - vars.min_size.x, vars.max_size.y - vars.min_size.y) * 0.5F + 1.F;
+    }
+
+    void Remove(const int index)
+    {
+        auto& grid_entity = grid.entities[index];
+        auto& cell = grid.cells[grid_entity.cell];
+
+        // Swap with the last entity, so the cell stays dense.
+        auto* const last = cell.back();
+        cell[grid_entity.position] = last;
+        grid.entities[IndexOfEdict(last)].position = grid_entity.position;
+        cell.pop_back();
+
+        grid_entity.cell = -1;
+    }
+
+    void Update(Edict* const entity, const int index)
+    {
+        if (static_cast<std::size_t>(index) >= grid.entities.size()) {
+            grid.entities.resize(static_cast<std::size_t>(index) + 1);
+        }
+
+        const auto old_cell = grid.entities[index].cell;
+        const auto new_cell = entity != nullptr && IsLive(entity) ? CellOf(entity->vars) : -1;
+
+        if (new_cell >= 0 && new_cell != OVERSIZED_CELL) {
+            grid.max_half_extent = std::max(grid.max_half_extent, HalfExtent(entity->vars));
+        }
+
+        if (old_cell != new_cell) {
+            if (old_cell >= 0) {
+                Remove(index);
+            }
+
+            if (new_cell >= 0) {
+                auto& cell = grid.cells[new_cell];
+                grid.entities[index].cell = new_cell;
+                grid.entities[index].position = cell.size();
+                cell.push_back(entity);
+            }
+        }
+
+        if (auto& grid_entity = grid.entities[index];
+            new_cell >= 0 && !grid_entity.moving && entity->vars.move_type != MoveTypeEntity::None) {
+            grid_entity.moving = true;
+            grid.moving.push_back(index);
+        }
+    }
+
+    void Update(Edict* const entity)
+    {
+        // The world is not indexed.
+        if (const auto index = entity != nullptr ? IndexOfEdict(entity) : 0; index > 0) {
+            Update(entity, index);
+        }
+    }
+
+    void OnSetOriginPost(Edict* const entity, const Vector& /*origin*/)
+    {
+        Update(entity);
+        SetResult(Result::Ignored);
+    }
+
+    void OnSetSizePost(Edict* const entity, const Vector& /*min*/, const Vector& /*max*/)
+    {
+        Update(entity);
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief The entities created by the game DLL or loaded from the map may be placed without a \c SetOrigin
+     * or \c SetSize call, so they are indexed at the next reconciliation.
+    */
+    Edict* OnCreateEntityPost()
+    {
+        if (auto* const entity = OrigRet<Edict*>(); entity != nullptr) {
+            grid.pending.push_back(entity);
+        }
+
+        SetResult(Result::Ignored);
+
+        return nullptr;
+    }
+
+    int OnSpawnPost(Edict* const entity)
+    {
+        grid.pending.push_back(entity);
+        SetResult(Result::Ignored);
+
+        return 0;
+    }
+
+    void OnFreeEntityPrivateDataPost(Edict* const entity)
+    {
+        if (const auto index = IndexOfEdict(entity);
+            index > 0 && static_cast<std::size_t>(index) < grid.entities.size() && grid.entities[index].cell >= 0) {
+            Remove(index);
+        }
+
+        SetResult(Result::Ignored);
+    }
+
+    /**
+     * @brief Indexes the pending entities and moves the entities moved by the physics since the previous frame.
+     * Only the entities with a move type are visited; the others move only through the hooked calls.
+    */
+    void OnStartFrame()
+    {
+        for (auto* const entity : grid.pending) {
+            Update(entity);
+        }
+
+        grid.pending.clear();
+
+        auto max_speed_squared = 0.F;
+
+        for (std::size_t i = 0; i < grid.moving.size();) {
+            const auto index = grid.moving[i];
+            auto* const entity = EntityOfEntIndex(index);
+            Update(entity, index);
+
+            if (auto& grid_entity = grid.entities[index];
+                grid_entity.cell < 0 || entity->vars.move_type == MoveTypeEntity::None) {
+                grid_entity.moving = false;
+                grid.moving[i] = grid.moving.back();
+                grid.moving.pop_back();
+                continue;
+            }
+
+            const auto& vars = entity->vars;
+            const Vector velocity{vars.velocity.x + vars.base_velocity.x, vars.velocity.y + vars.base_velocity.y, 0.F};
+            max_speed_squared = std::max(max_speed_squared, velocity.x * velocity.x + velocity.y * velocity.y);
+            ++i;
+        }
+
+        // Allow twice the distance the fastest entity covers in a frame.
+        grid.movement_slack = 2.F * std::sqrt(max_speed_squared) * g_global_vars->frame_time;
+
+        SetResult(Result::Ignored);
+    }
+
+    void OnServerDeactivatePost()
+    {
+        for (auto& cell : grid.cells) {
+            cell.clear();
+        }
+
+        grid.entities.clear();
+        grid.moving.clear();
+        grid.pending.clear();
+        grid.movement_slack = 0.F;
+        grid.max_half_extent = 0.F;
+
+        SetResult(Result::Ignored);
+    }
+
+    void StartIndexing()
+    {
+        grid.indexing = true;
+        grid.cells.resize(OVERSIZED_CELL + 1);
+
+        // Internal hooks are kept when the plugin replaces or clears its hooks, so they are installed once.
+        metamod::detail::SetInternalHook<&EngineFunctions::set_origin>(&OnSetOriginPost, true);
+        metamod::detail::SetInternalHook<&EngineFunctions::set_size>(&OnSetSizePost, true);
+        metamod::detail::SetInternalHook<&EngineFunctions::create_entity>(&OnCreateEntityPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::spawn>(&OnSpawnPost, true);
+        metamod::detail::SetInternalHook<&DllNewFunctions::free_entity_private_data>(&OnFreeEntityPrivateDataPost, true);
+        metamod::detail::SetInternalHook<&DllFunctions::start_frame>(&OnStartFrame, false, INT_MAX);
+        metamod::detail::SetInternalHook<&DllFunctions::server_deactivate>(&OnServerDeactivatePost, true);
+
+        // The entities that exist already are indexed once.
+        for (auto index = 1; index < g_global_vars->max_entities; ++index) {
+            if (auto* const entity = EntityOfEntIndex(index); entity != nullptr) {
+                Update(entity, index);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls \c visit for every entity in the cells overlapping the given area and the oversized cell.
+    */
+    template <typename TVisitor>
+    FORCEINLINE void VisitCells(const float min_x, const float min_y, const float max_x, const float max_y,
+                                const TVisitor& visit)
+    {
+        const auto first_x = AxisCell(min_x);
+        const auto last_x = AxisCell(max_x);
+        const auto last_y = AxisCell(max_y);
+
+        for (auto y = AxisCell(min_y); y <= last_y; ++y) {
+            for (auto x = first_x; x <= last_x; ++x) {
+                for (auto* const entity : grid.cells[y * GRID_CELLS_PER_AXIS + x]) {
+                    visit(entity);
+                }
+            }
+        }
+
+        for (auto* const entity : grid.cells[OVERSIZED_CELL]) {
+            visit(entity);
+        }
+    }
+
+    void QuerySphere(const Vector& origin, const float radius, std::vector<Edict*>& result)
+    {
+        if (!grid.indexing) {
+            StartIndexing();
+        }
+
+        // An entity is found if its absolute bounds are within the radius, and their edge is at most
+        // max_half_extent away from the center the entity is indexed by.
+        const auto reach = radius + grid.max_half_extent + grid.movement_slack;
+        const auto radius_squared = radius * radius;
+
+        VisitCells(origin.x - reach, origin.y - reach, origin.x + reach, origin.y + reach, [&](Edict* const entity) {
+            if (!IsFindable(entity)) {
+                return;
+            }
+
+            // Distance from the origin to the nearest point of the absolute bounds, like FindEntityInSphere.
+            const auto& vars = entity->vars;
+            const auto dx = origin.x - std::clamp(origin.x, vars.abs_min.x, vars.abs_max.x);
+            const auto dy = origin.y - std::clamp(origin.y, vars.abs_min.y, vars.abs_max.y);
+            const auto dz = origin.z - std::clamp(origin.z, vars.abs_min.z, vars.abs_max.z);
+
+            if (dx * dx + dy * dy + dz * dz <= radius_squared) {
+                result.push_back(entity);
+            }
+        });
+    }
+}
+
+namespace metamod::engine
+{
+    std::size_t FindEntitiesInSphere(const Vector& origin, const float radius, std::vector<Edict*>& result)
+    {
+        result.clear();
+        QuerySphere(origin, radius, result);
+
+        return result.size();
+    }
+
+    std::size_t FindEntitiesInBox(const Vector& min, const Vector& max, std::vector<Edict*>& result)
+    {
+        if (!grid.indexing) {
+            StartIndexing();
+        }
+
+        const auto reach = grid.max_half_extent + grid.movement_slack;
+        result.clear();
+
+        VisitCells(min.x - reach, min.y - reach, max.x + reach, max.y + reach, [&](Edict* const entity) {
+            if (!IsFindable(entity)) {
+                return;
+            }
+
+            const auto& vars = entity->vars;
+
+            if (vars.abs_min.x <= max.x && vars.abs_max.x >= min.x && vars.abs_min.y <= max.y && vars.abs_max.y >= min.y &&
+                vars.abs_min.z <= max.z && vars.abs_max.z >= min.z) {
+                result.push_back(entity);
+            }
+        });
+
+        return result.size();
+    }
+
+    void FindEntitiesInSpheres(const SphereQuery* const queries, const std::size_t count, std::vector<Edict*>& result,
+                               std::vector<std::size_t>& offsets)
+    {
+        result.clear();
+        offsets.resize(count + 1);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            offsets[i] = result.size();
+            QuerySphere(queries[i].origin, queries[i].radius, result);
+        }
+
+        offsets[count] = result.size();
+    }
+}
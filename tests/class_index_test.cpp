@@ -0,0 +1,211 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/class_index.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <algorithm>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    constexpr auto MAX_ENTITIES = 16;
+
+    /**
+     * @brief Class names by string offset.
+    */
+    const char* const strings[] = {"", "player", "hostage", "weapon_c4", "grenade"};
+
+    Globals globals{};
+    GlobalVars global_vars{};
+    Edict entities[MAX_ENTITIES]{};
+    Edict* created_entity{};
+
+    const char* StringFromIndex(const unsigned int string)
+    {
+        return strings[string];
+    }
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    Edict* EntityOfIndex(const int index)
+    {
+        return &entities[index];
+    }
+
+    void SetClass(const int index, const unsigned int class_name)
+    {
+        entities[index].private_data = &entities[index];
+        entities[index].vars.classname = Strind(class_name);
+    }
+
+    /**
+     * @brief Returns the indexes of the entities of the class, sorted.
+    */
+    std::vector<int> Indexes(const char* const class_name)
+    {
+        std::vector<int> result{};
+
+        for (auto* const entity : EntitiesByClass(class_name)) {
+            result.push_back(IndexOfEntity(entity));
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    void Free(const int index)
+    {
+        gamedll::detail::dll_new_post_hooks->free_entity_private_data(&entities[index]);
+        entities[index] = {};
+    }
+
+    void TestExistingEntities()
+    {
+        for (auto index = 1; index <= 5; ++index) {
+            SetClass(index, 1);
+        }
+
+        SetClass(6, 2);
+
+        META_CHECK((Indexes("player") == std::vector{1, 2, 3, 4, 5}));
+        META_CHECK((Indexes("hostage") == std::vector{6}));
+        META_CHECK(Indexes("weapon_c4").empty());
+    }
+
+    void TestSwapRemove()
+    {
+        // The last entity of the list takes the position of the removed one; removing it afterwards
+        // must find it at its new position.
+        Free(1);
+        META_CHECK((Indexes("player") == std::vector{2, 3, 4, 5}));
+
+        Free(5);
+        META_CHECK((Indexes("player") == std::vector{2, 3, 4}));
+
+        Free(3);
+        Free(4);
+        META_CHECK((Indexes("player") == std::vector{2}));
+
+        // Freeing an entity twice or an entity that is not indexed does nothing.
+        Free(4);
+        Free(12);
+        META_CHECK((Indexes("player") == std::vector{2}));
+        META_CHECK((Indexes("hostage") == std::vector{6}));
+    }
+
+    void TestCreateAndSpawn()
+    {
+        SetClass(7, 3);
+        created_entity = &entities[7];
+        globals.orig_ret = &created_entity;
+        engine::detail::engine_post_hooks->create_named_entity(Strind(3));
+        META_CHECK((Indexes("weapon_c4") == std::vector{7}));
+
+        // Spawn moves an entity whose class name changed to its new list.
+        SetClass(2, 2);
+        gamedll::detail::dll_post_hooks->spawn(&entities[2]);
+        META_CHECK(Indexes("player").empty());
+        META_CHECK((Indexes("hostage") == std::vector{2, 6}));
+
+        SetClass(6, 1);
+        UpdateClassIndex(&entities[6]);
+        META_CHECK((Indexes("player") == std::vector{6}));
+        META_CHECK((Indexes("hostage") == std::vector{2}));
+
+        // Spawning an indexed entity again does not add it twice.
+        gamedll::detail::dll_post_hooks->spawn(&entities[6]);
+        META_CHECK((Indexes("player") == std::vector{6}));
+    }
+
+    /**
+     * @brief The game DLL creates the entity, then sets its class name and spawns it without the hooks.
+    */
+    void TestGameDllEntities()
+    {
+        created_entity = &entities[8];
+        globals.orig_ret = &created_entity;
+        entities[8].private_data = &entities[8];
+        engine::detail::engine_post_hooks->create_entity();
+
+        // Created but not named yet.
+        META_CHECK(Indexes("grenade").empty());
+
+        entities[8].vars.classname = Strind(4);
+        META_CHECK((Indexes("grenade") == std::vector{8}));
+
+        // A bot that bypasses the ClientPutInServer hook.
+        created_entity = &entities[9];
+        engine::detail::engine_post_hooks->create_fake_client("bot");
+        SetClass(9, 1);
+        META_CHECK((Indexes("player") == std::vector{6, 9}));
+
+        // A player whose class name is set by ClientPutInServer.
+        SetClass(10, 1);
+        gamedll::detail::dll_post_hooks->client_put_in_server(&entities[10]);
+        META_CHECK((Indexes("player") == std::vector{6, 9, 10}));
+
+        // A created entity that is freed before the lookup is not indexed.
+        created_entity = &entities[11];
+        engine::detail::engine_post_hooks->create_entity();
+        SetClass(11, 4);
+        Free(11);
+        META_CHECK((Indexes("grenade") == std::vector{8}));
+
+        META_CHECK(EntitiesByClass(nullptr).empty());
+    }
+
+    void TestServerDeactivate()
+    {
+        gamedll::detail::dll_post_hooks->server_deactivate();
+        META_CHECK(Indexes("player").empty());
+        META_CHECK(Indexes("hostage").empty());
+        META_CHECK(Indexes("weapon_c4").empty());
+        META_CHECK(Indexes("grenade").empty());
+
+        gamedll::detail::dll_post_hooks->spawn(&entities[6]);
+        META_CHECK((Indexes("player") == std::vector{6}));
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_global_vars = &global_vars;
+    global_vars.max_entities = MAX_ENTITIES;
+
+    g_engine_funcs.sz_from_index = &StringFromIndex;
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+    g_engine_funcs.entity_of_ent_index = &EntityOfIndex;
+
+    TestExistingEntities();
+    TestSwapRemove();
+    TestCreateAndSpawn();
+    TestGameDllEntities();
+    TestServerDeactivate();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/coalesced_messages.h>
+#include <metamod/gamedll_hooks.h>
+#include <string>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    Globals globals{};
+    Edict entities[4]{};
+
+    /**
+     * @brief Engine calls of the sent messages, one entry per message.
+    */
+    std::vector<std::string> sent{};
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    Edict* EntityOfIndex(const int index)
+    {
+        return &entities[index];
+    }
+
+    void MessageBeginCall(const MessageType msg_type, const int msg_id, const float*, Edict* const client)
+    {
+        sent.push_back(std::to_string(static_cast<int>(msg_type)) + " " + std::to_string(msg_id) + " " +
+                       std::to_string(client != nullptr ? IndexOfEntity(client) : 0));
+    }
+
+    void MessageEndCall()
+    {
+    }
+
+    void WriteByteCall(const int value)
+    {
+        sent.back() += " " + std::to_string(value);
+    }
+
+    void Queue(const int msg_id, const int value, Edict* const client = nullptr, const int key = 0)
+    {
+        MessageBuilder message{msg_id};
+        message.WriteByte(value);
+        SendCoalesced(message, client, key, true, MessageReplay::Fields);
+    }
+
+    std::string All(const int msg_id, const int value)
+    {
+        return std::to_string(static_cast<int>(MessageType::All)) + " " + std::to_string(msg_id) + " 0 " +
+               std::to_string(value);
+    }
+
+    std::string One(const int msg_id, const int client, const int value)
+    {
+        return std::to_string(static_cast<int>(MessageType::One)) + " " + std::to_string(msg_id) + " " +
+               std::to_string(client) + " " + std::to_string(value);
+    }
+
+    void TestSupersede()
+    {
+        Queue(70, 1);
+        Queue(71, 2);
+        Queue(70, 3);
+        Queue(70, 4, nullptr, 5);
+
+        // The last message of a (client, ID, key) is sent at the position of the first one.
+        FlushCoalescedMessages();
+        META_CHECK((sent == std::vector{All(70, 3), All(71, 2), All(70, 4)}));
+
+        sent.clear();
+        FlushCoalescedMessages();
+        META_CHECK(sent.empty());
+    }
+
+    void TestClientMessages()
+    {
+        sent.clear();
+        Queue(70, 1, &entities[1]);
+        Queue(70, 2, &entities[2]);
+        Queue(70, 3);
+        Queue(70, 4, &entities[1]);
+
+        gamedll::detail::dll_post_hooks->player_post_think(&entities[1]);
+        META_CHECK((sent == std::vector{One(70, 1, 4)}));
+
+        // A message queued after the client was flushed is queued again.
+        Queue(70, 5, &entities[1]);
+
+        entities[2].free = 1;
+        sent.clear();
+        gamedll::detail::dll_post_hooks->start_frame();
+        META_CHECK((sent == std::vector{All(70, 3), One(70, 1, 5)}));
+
+        entities[2].free = 0;
+    }
+
+    void TestServerDeactivate()
+    {
+        Queue(70, 1);
+        gamedll::detail::dll_hooks->server_deactivate();
+
+        sent.clear();
+        Queue(70, 2);
+        FlushCoalescedMessages();
+        META_CHECK((sent == std::vector{All(70, 2)}));
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+
+    auto& engine = g_engine_funcs;
+    engine.index_of_edict = &IndexOfEntity;
+    engine.entity_of_ent_index = &EntityOfIndex;
+    engine.message_begin = &MessageBeginCall;
+    engine.message_end = &MessageEndCall;
+    engine.write_byte = &WriteByteCall;
+
+    for (auto& entity : entities) {
+        entity.vars.flags = FL_CLIENT;
+    }
+
+    TestSupersede();
+    TestClientMessages();
+    TestServerDeactivate();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
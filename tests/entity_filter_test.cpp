@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/entity_filter.h>
+#include <metamod/gamedll_hooks.h>
+#include <string>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+
+namespace
+{
+    /**
+     * @brief Class names by string offset.
+    */
+    const char* const strings[] = {"", "player", "grenade"};
+
+    Globals globals{};
+    Edict entities[8]{};
+    std::vector<int> calls{};
+    int alerts{};
+
+    const char* StringFromIndex(const unsigned int string)
+    {
+        return strings[string];
+    }
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    void AlertMessageCall(AlertType, const char*, ...)
+    {
+        ++alerts;
+    }
+
+    template <int Id>
+    void Callback(Edict*)
+    {
+        calls.push_back(Id);
+        SetResult(Result::Ignored);
+    }
+
+    void Think(const int index)
+    {
+        calls.clear();
+        gamedll::detail::dll_hooks->think(&entities[index]);
+    }
+
+    void TestPriorityOrder()
+    {
+        const gamedll::EntityFilter grenades{{"grenade"}};
+
+        gamedll::HookThink(&Callback<1>, false, 10);
+        gamedll::HookThink(&Callback<2>, false, grenades);
+        gamedll::HookThink(&Callback<3>, false, grenades, 20);
+        gamedll::HookThink(&Callback<4>, false, 5);
+
+        // Filtered callbacks are ordered by priority among the unfiltered ones.
+        Think(2);
+        META_CHECK((calls == std::vector{3, 1, 4, 2}));
+
+        Think(1);
+        META_CHECK((calls == std::vector{1, 4}));
+
+        // Removing the filtered callbacks keeps the unfiltered ones.
+        gamedll::HookThink(nullptr, false, grenades);
+
+        Think(2);
+        META_CHECK((calls == std::vector{1, 4}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestIndexFilter()
+    {
+        gamedll::HookThink(&Callback<1>, false, {{}, {1, 3}});
+
+        Think(1);
+        META_CHECK((calls == std::vector{1}));
+
+        Think(2);
+        META_CHECK(calls.empty());
+        META_CHECK(globals.result == Result::Ignored);
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestFilterIdsReused()
+    {
+        // The filters of removed callbacks are released, so the filter limit is never reached.
+        for (auto i = 0; i < 3 * static_cast<int>(gamedll::detail::MAX_ENTITY_FILTERS); ++i) {
+            gamedll::HookThink(&Callback<1>, false, {{std::to_string(i)}, {4}});
+            gamedll::HookThink(&Callback<2>, true, {{}, {4, i}});
+            gamedll::detail::ClearGameDllHooks();
+        }
+
+        META_CHECK(alerts == 0);
+        META_CHECK(gamedll::detail::entity_filters.size() <= 2);
+
+        // Adding a callback again releases its previous filter.
+        for (auto i = 0; i < 3 * static_cast<int>(gamedll::detail::MAX_ENTITY_FILTERS); ++i) {
+            gamedll::HookThink(&Callback<1>, false, {{}, {5, i}});
+        }
+
+        META_CHECK(alerts == 0);
+        Think(5);
+        META_CHECK((calls == std::vector{1}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_engine_funcs.sz_from_index = &StringFromIndex;
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+    g_engine_funcs.alert_message = &AlertMessageCall;
+
+    entities[1].vars.classname = Strind(1);
+    entities[2].vars.classname = Strind(2);
+
+    TestPriorityOrder();
+    TestIndexFilter();
+    TestFilterIdsReused();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/entity_handle.h>
+#include <metamod/gamedll_hooks.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    Globals globals{};
+    Edict entities[16]{};
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    /**
+     * @brief Frees the entity the way the engine does: both hooks are called.
+    */
+    void Free(Edict* const entity)
+    {
+        gamedll::detail::dll_new_post_hooks->free_entity_private_data(entity);
+        engine::detail::engine_post_hooks->remove_entity(entity);
+    }
+
+    void TestNullHandle()
+    {
+        constexpr EntityHandle null{};
+        META_CHECK(null.Get() == nullptr);
+        META_CHECK(null.Value() == 0);
+
+        META_CHECK(!EntityHandle{nullptr}.IsValid());
+
+        entities[9].free = 1;
+        META_CHECK(EntityHandle{&entities[9]}.Value() == 0);
+        entities[9].free = 0;
+
+        // The world is a valid entity.
+        META_CHECK(EntityHandle{&entities[0]}.Get() == &entities[0]);
+    }
+
+    void TestGenerations()
+    {
+        const EntityHandle handle{&entities[7]};
+        META_CHECK(handle.Get() == &entities[7]);
+        META_CHECK(handle.Index() == 7);
+        META_CHECK(EntityHandle::FromValue(handle.Value()) == handle);
+
+        Free(&entities[7]);
+        META_CHECK(handle.Get() == nullptr);
+        META_CHECK(handle.Index() == 7);
+
+        // The slot is reused by a new entity; the generation is incremented once per free.
+        const EntityHandle reused{&entities[7]};
+        META_CHECK(reused.IsValid());
+        META_CHECK(reused != handle);
+        META_CHECK(reused.Value() >> EntityHandle::INDEX_BITS == (handle.Value() >> EntityHandle::INDEX_BITS) + 1);
+        META_CHECK(!handle.IsValid());
+
+        // Other slots are not affected.
+        const EntityHandle other{&entities[3]};
+        Free(&entities[7]);
+        META_CHECK(other.IsValid());
+    }
+
+    void TestServerDeactivate()
+    {
+        const EntityHandle first{&entities[1]};
+        const EntityHandle second{&entities[2]};
+
+        gamedll::detail::dll_post_hooks->server_deactivate();
+        META_CHECK(!first.IsValid());
+        META_CHECK(!second.IsValid());
+        META_CHECK(EntityHandle{&entities[1]}.IsValid());
+    }
+
+    void TestGenerationWrap()
+    {
+        const EntityHandle first{&entities[5]};
+        engine::detail::handle_slots[5].generation = EntityHandle::MAX_GENERATION;
+
+        const EntityHandle last{&entities[5]};
+        Free(&entities[5]);
+
+        // The generation wraps to 1, never to 0.
+        const EntityHandle wrapped{&entities[5]};
+        META_CHECK(wrapped.Value() >> EntityHandle::INDEX_BITS == 1);
+        META_CHECK(!last.IsValid());
+        META_CHECK(wrapped.IsValid());
+        META_CHECK(wrapped != first);
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+
+    TestNullHandle();
+    TestGenerations();
+    TestServerDeactivate();
+    TestGenerationWrap();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
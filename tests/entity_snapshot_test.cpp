@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/entity_snapshot.h>
+#include <metamod/gamedll_hooks.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    constexpr auto MAX_ENTITIES = 40;
+    constexpr auto FIELDS = SNAPSHOT_ORIGIN | SNAPSHOT_HEALTH;
+
+    Globals globals{};
+    GlobalVars global_vars{};
+    Edict entities[MAX_ENTITIES]{};
+    int private_data{};
+
+    Edict* EntityOfIndex(const int index)
+    {
+        return &entities[index];
+    }
+
+    void Spawn(const int index)
+    {
+        entities[index].private_data = &private_data;
+        ++entities[index].serial_number;
+    }
+
+    const EntitySnapshot& StartFrame()
+    {
+        gamedll::detail::dll_hooks->start_frame();
+        return GetEntitySnapshot();
+    }
+
+    void TestDirtyFields()
+    {
+        Spawn(1);
+        Spawn(2);
+
+        const auto* snapshot = &StartFrame();
+        META_CHECK(snapshot->count == 2);
+        META_CHECK(snapshot->padded_count == SNAPSHOT_ROW_PADDING);
+        META_CHECK(snapshot->indices[1] == 2);
+        META_CHECK(snapshot->dirty[0] == FIELDS && snapshot->dirty[1] == FIELDS);
+        META_CHECK(snapshot->velocity_x == nullptr);
+
+        entities[2].vars.health = 50.0F;
+
+        snapshot = &StartFrame();
+        META_CHECK(snapshot->dirty[0] == 0);
+        META_CHECK(snapshot->dirty[1] == SNAPSHOT_HEALTH);
+        META_CHECK(snapshot->health[1] == 50.0F);
+
+        // A reused slot holds a new entity.
+        Spawn(1);
+
+        snapshot = &StartFrame();
+        META_CHECK(snapshot->dirty[0] == FIELDS);
+        META_CHECK(snapshot->dirty[1] == 0);
+    }
+
+    void TestBuffersGrow()
+    {
+        // The buffers are reallocated, so every entity is new to the snapshot.
+        global_vars.max_entities = MAX_ENTITIES;
+        Spawn(30);
+
+        const auto& snapshot = StartFrame();
+        META_CHECK(snapshot.count == 3);
+        META_CHECK(snapshot.indices[2] == 30);
+
+        for (std::size_t row = 0; row < snapshot.count; ++row) {
+            META_CHECK(snapshot.dirty[row] == FIELDS);
+        }
+
+        META_CHECK(StartFrame().dirty[2] == 0);
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_global_vars = &global_vars;
+    global_vars.max_entities = 4;
+    g_engine_funcs.entity_of_ent_index = &EntityOfIndex;
+
+    EnableEntitySnapshot(FIELDS);
+
+    TestDirtyFields();
+    TestBuffersGrow();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_callable.h>
+#include <metamod/hook_slot.h>
+
+using namespace cssdk;
+using namespace metamod;
+
+namespace
+{
+    Globals globals{};
+
+    struct Mode
+    {
+        int thinks{};
+
+        void OnThink(Edict*)
+        {
+            ++thinks;
+            SetResult(Result::Handled);
+        }
+
+        void OnVecToAngles(const Vector& direction, Vector& angles)
+        {
+            angles = Vector{direction.z, direction.y, direction.x};
+            SetResult(Result::Supercede);
+        }
+
+        void OnAngleVectors(const Vector&, Vector& forward, Vector& right, Vector& up)
+        {
+            forward.x = 1.F;
+            right.y = 2.F;
+            up.z = 3.F;
+            SetResult(Result::Supercede);
+        }
+    };
+
+    void TestCallables()
+    {
+        auto total = 0;
+        const auto make = [&total](const int amount) {
+            return [&total, amount](Edict*) {
+                total += amount;
+                SetResult(Result::Handled);
+            };
+        };
+
+        const auto first = HookCallable<&DllFunctions::think>(make(1), false);
+        const auto second = HookCallable<&DllFunctions::think>(make(10), false);
+        META_CHECK(first != nullptr && second != nullptr && first != second);
+
+        gamedll::detail::dll_hooks->think(nullptr);
+        META_CHECK(total == 11);
+
+        // The storage of a removed callable is reused.
+        RemoveHook<&DllFunctions::think>(first, false);
+        const auto third = HookCallable<&DllFunctions::think>(make(100), false);
+        META_CHECK(third == first);
+
+        gamedll::detail::dll_hooks->think(nullptr);
+        META_CHECK(total == 121);
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestMethods()
+    {
+        Mode mode{};
+        HookMethod<&DllFunctions::think, &Mode::OnThink>(&mode, false);
+
+        gamedll::detail::dll_hooks->think(nullptr);
+        META_CHECK(mode.thinks == 1);
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    /**
+     * @brief The output vectors of the hook are written by the method, not by a copy.
+    */
+    void TestOutParameters()
+    {
+        Mode mode{};
+        HookMethod<&EngineFunctions::vec_to_angles, &Mode::OnVecToAngles>(&mode, false);
+        HookMethod<&EngineFunctions::angle_vectors, &Mode::OnAngleVectors>(&mode, false);
+
+        Vector angles{};
+        engine::detail::engine_hooks->vec_to_angles(Vector{1.F, 2.F, 3.F}, angles);
+        META_CHECK(angles.x == 3.F && angles.y == 2.F && angles.z == 1.F);
+
+        Vector forward{}, right{}, up{};
+        engine::detail::engine_hooks->angle_vectors(Vector{}, forward, right, up);
+        META_CHECK(forward.x == 1.F && right.y == 2.F && up.z == 3.F);
+
+        engine::detail::ClearEngineHooks();
+
+        // A capturing lambda receives the same references.
+        auto calls = 0;
+        HookCallable<&EngineFunctions::vec_to_angles>([&calls](const Vector&, Vector& result) {
+            ++calls;
+            result.x = 5.F;
+            SetResult(Result::Supercede);
+        }, false);
+
+        engine::detail::engine_hooks->vec_to_angles(Vector{}, angles);
+        META_CHECK(calls == 1);
+        META_CHECK(angles.x == 5.F);
+
+        engine::detail::ClearEngineHooks();
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+
+    TestCallables();
+    TestMethods();
+    TestOutParameters();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_slot.h>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+
+namespace
+{
+    Globals globals{};
+    std::vector<int> calls{};
+
+    void First(Edict*)
+    {
+        calls.push_back(1);
+        SetResult(Result::Handled);
+    }
+
+    void Second(Edict*)
+    {
+        calls.push_back(2);
+        SetResult(Result::Ignored);
+    }
+
+    void Third(Edict*)
+    {
+        calls.push_back(3);
+        SetResult(Result::Ignored);
+    }
+
+    void Superceding(Edict*)
+    {
+        calls.push_back(4);
+        SetResult(Result::Supercede);
+    }
+
+    int Overriding(const char*)
+    {
+        SetResult(Result::Override);
+        return 5;
+    }
+
+    int Ignoring(const char*)
+    {
+        SetResult(Result::Ignored);
+        return 7;
+    }
+
+    void Dispatch()
+    {
+        calls.clear();
+        globals.result = Result::Unset;
+        gamedll::detail::dll_hooks->player_pre_think(nullptr);
+    }
+
+    void TestSingleCallback()
+    {
+        gamedll::HookPlayerPreThink(&First, false);
+
+        // A single callback is written into the table directly.
+        META_CHECK(gamedll::detail::dll_hooks->player_pre_think == &First);
+
+        gamedll::detail::ClearGameDllHooks();
+        META_CHECK(gamedll::detail::dll_hooks->player_pre_think == nullptr);
+    }
+
+    void TestPriorityOrder()
+    {
+        gamedll::HookPlayerPreThink(&First, false);
+        gamedll::HookPlayerPreThink(&Second, false);
+        gamedll::HookPlayerPreThink(&Third, false, 10);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{3, 1, 2}));
+        META_CHECK(globals.result == Result::Handled);
+
+        // Adding a callback again changes its priority.
+        gamedll::HookPlayerPreThink(&First, false, -10);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{3, 2, 1}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestSupercede()
+    {
+        gamedll::HookPlayerPreThink(&First, false, 10);
+        gamedll::HookPlayerPreThink(&Superceding, false);
+        gamedll::HookPlayerPreThink(&Second, false, -10);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{1, 4}));
+        META_CHECK(globals.result == Result::Supercede);
+
+        RemoveHook<&DllFunctions::player_pre_think>(&Superceding, false);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{1, 2}));
+        META_CHECK(globals.result == Result::Handled);
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestReturnValue()
+    {
+        engine::HookPrecacheModel(&Overriding, true);
+        engine::HookPrecacheModel(&Ignoring, true);
+
+        // The value of an ignored callback does not replace the value of an overriding one.
+        globals.result = Result::Unset;
+        META_CHECK(engine::detail::engine_post_hooks->precache_model("model") == 5);
+        META_CHECK(globals.result == Result::Override);
+
+        engine::detail::ClearEngineHooks();
+    }
+
+    void TestInternalHooks()
+    {
+        metamod::detail::SetInternalHook<&DllFunctions::player_pre_think>(&Third, false, 10);
+        gamedll::HookPlayerPreThink(&First, false);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{3, 1}));
+
+        // Clearing the hooks of the plugin keeps the hooks of the SDK.
+        gamedll::HookPlayerPreThink(nullptr, false);
+
+        Dispatch();
+        META_CHECK((calls == std::vector{3}));
+
+        gamedll::HookPlayerPreThink(&Second, false);
+        gamedll::detail::ClearGameDllHooks();
+
+        Dispatch();
+        META_CHECK((calls == std::vector{3}));
+
+        gamedll::detail::ClearGameDllHooks(true);
+        META_CHECK(gamedll::detail::dll_hooks->player_pre_think == nullptr);
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+
+    TestSingleCallback();
+    TestPriorityOrder();
+    TestSupercede();
+    TestReturnValue();
+    TestInternalHooks();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
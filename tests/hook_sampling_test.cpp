@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_sampling.h>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+
+namespace
+{
+    Globals globals{};
+    int call{};
+    std::vector<int> every_third{};
+    std::vector<int> every_fifth{};
+    std::vector<int> added_later{};
+    int sampled{};
+    int observed{};
+
+    void EveryThird(const Edict*, const UserCmd*, unsigned int)
+    {
+        every_third.push_back(call);
+        SetResult(Result::Supercede);
+    }
+
+    void EveryFifth(const Edict*, const UserCmd*, unsigned int)
+    {
+        every_fifth.push_back(call);
+    }
+
+    void AddedLater(const Edict*, const UserCmd*, unsigned int)
+    {
+        added_later.push_back(call);
+    }
+
+    void Sampled(const Edict*, const UserCmd*, unsigned int)
+    {
+        ++sampled;
+    }
+
+    void Observer(const Edict*, const UserCmd*, unsigned int)
+    {
+        ++observed;
+        SetResult(Result::Ignored);
+    }
+
+    void Call(const int count)
+    {
+        for (auto i = 0; i < count; ++i) {
+            ++call;
+            gamedll::detail::dll_post_hooks->cmd_start(nullptr, nullptr, 0);
+        }
+    }
+
+    void TestPeriod()
+    {
+        gamedll::HookCmdStart(&EveryThird, true, HookSampling{3});
+        gamedll::HookCmdStart(&EveryFifth, true, HookSampling{5});
+        gamedll::HookCmdStart(&Observer, true);
+
+        Call(15);
+        META_CHECK((every_third == std::vector{3, 6, 9, 12, 15}));
+        META_CHECK((every_fifth == std::vector{5, 10, 15}));
+
+        // The unsampled callback sees every call, and the results of the sampled ones are ignored.
+        META_CHECK(observed == 15);
+        META_CHECK(globals.result == Result::Ignored);
+    }
+
+    void TestAddDuringCountdown()
+    {
+        // The countdown of a callback starts when it is added, not at the start of the countdown of the slot.
+        Call(1);
+        gamedll::HookCmdStart(&AddedLater, true, HookSampling{4});
+
+        Call(8);
+        META_CHECK((added_later == std::vector{20, 24}));
+        META_CHECK((every_third == std::vector{3, 6, 9, 12, 15, 18, 21, 24}));
+        META_CHECK((every_fifth == std::vector{5, 10, 15, 20}));
+    }
+
+    void TestRemove()
+    {
+        gamedll::HookCmdStart(nullptr, true, HookSampling{});
+        Call(10);
+
+        META_CHECK(every_third.size() == 8);
+        META_CHECK(observed == 34);
+
+        gamedll::HookCmdStart(nullptr, true);
+        META_CHECK(gamedll::detail::dll_post_hooks->cmd_start == nullptr);
+    }
+
+    void TestProbability()
+    {
+        gamedll::HookCmdStart(&Sampled, true, HookSampling{1, 1.0});
+        Call(100);
+        META_CHECK(sampled == 100);
+
+        sampled = 0;
+        gamedll::HookCmdStart(&Sampled, true, HookSampling{1, 0.25});
+        Call(100000);
+        META_CHECK(sampled > 24000 && sampled < 26000);
+
+        gamedll::HookCmdStart(nullptr, true, HookSampling{});
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+
+    TestPeriod();
+    TestAddDuringCountdown();
+    TestRemove();
+    TestProbability();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
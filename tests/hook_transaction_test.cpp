@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/hook_transaction.h>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+
+namespace
+{
+    Globals globals{};
+    std::vector<int> calls{};
+
+    void OldStartFrame()
+    {
+        calls.push_back(1);
+        SetResult(Result::Ignored);
+    }
+
+    void NewStartFrame()
+    {
+        calls.push_back(2);
+        SetResult(Result::Ignored);
+    }
+
+    void OldThink(Edict*)
+    {
+        calls.push_back(3);
+        SetResult(Result::Ignored);
+    }
+
+    void NewThink(Edict*)
+    {
+        calls.push_back(4);
+        SetResult(Result::Ignored);
+    }
+
+    void StartFrame()
+    {
+        calls.clear();
+        gamedll::detail::dll_hooks->start_frame();
+    }
+
+    void Think()
+    {
+        calls.clear();
+        gamedll::detail::dll_hooks->think(nullptr);
+    }
+
+    void TestStagedChanges()
+    {
+        gamedll::HookThink(&OldThink, false);
+
+        StageHooks([] { gamedll::HookThink(&NewThink, false); });
+
+        // Nothing changes until the next frame.
+        Think();
+        META_CHECK((calls == std::vector{3}));
+
+        StartFrame();
+        Think();
+        META_CHECK((calls == std::vector{3, 4}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestReplaceDuringStartFrame()
+    {
+        gamedll::HookStartFrame(&OldStartFrame, false);
+        gamedll::HookThink(&OldThink, false);
+
+        StageHooks([] {
+            gamedll::HookStartFrame(&NewStartFrame, false);
+            gamedll::HookThink(&NewThink, false);
+        }, true);
+
+        // The replace is applied once the StartFrame chain the commit runs in has been dispatched.
+        StartFrame();
+        META_CHECK((calls == std::vector{1}));
+
+        Think();
+        META_CHECK((calls == std::vector{4}));
+
+        StartFrame();
+        META_CHECK((calls == std::vector{2}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+
+    void TestCommitOutsideDispatch()
+    {
+        StageHooks([] { gamedll::HookThink(&NewThink, false); }, true);
+        CommitStagedHooks();
+
+        Think();
+        META_CHECK((calls == std::vector{4}));
+
+        gamedll::detail::ClearGameDllHooks();
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+
+    TestStagedChanges();
+    TestReplaceDuringStartFrame();
+    TestCommitOutsideDispatch();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,271 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/message_builder.h>
+#include <metamod/message_hooks.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod::engine;
+
+namespace
+{
+    metamod::Globals globals{};
+
+    /**
+     * @brief Engine calls of the sent messages, one entry per call.
+    */
+    std::vector<std::string> calls{};
+
+    /**
+     * @brief Bytes of the sent messages, encoded the way the engine encodes them.
+    */
+    std::vector<std::uint8_t> wire{};
+
+    void Put(const int value, const int size)
+    {
+        for (auto i = 0; i < size; ++i) {
+            wire.push_back(static_cast<std::uint8_t>(static_cast<std::uint32_t>(value) >> (8 * i)));
+        }
+    }
+
+    void MessageBeginCall(const MessageType msg_type, const int msg_id, const float*, Edict*)
+    {
+        calls.push_back("begin " + std::to_string(static_cast<int>(msg_type)) + " " + std::to_string(msg_id));
+    }
+
+    void MessageEndCall()
+    {
+        calls.emplace_back("end");
+    }
+
+    void WriteByteCall(const int value)
+    {
+        calls.push_back("byte " + std::to_string(value));
+        Put(value, 1);
+    }
+
+    void WriteCharCall(const int value)
+    {
+        calls.push_back("char " + std::to_string(value));
+        Put(value, 1);
+    }
+
+    void WriteShortCall(const int value)
+    {
+        calls.push_back("short " + std::to_string(value));
+        Put(value, 2);
+    }
+
+    void WriteLongCall(const int value)
+    {
+        calls.push_back("long " + std::to_string(value));
+        Put(value, 4);
+    }
+
+    void WriteAngleCall(const float value)
+    {
+        calls.push_back("angle " + std::to_string(value));
+        Put(static_cast<int>(static_cast<std::int64_t>(value * 256.0 / 360.0) & 0xFF), 1);
+    }
+
+    void WriteCoordCall(const float value)
+    {
+        calls.push_back("coord " + std::to_string(value));
+        Put(static_cast<int>(value * 8.0), 2);
+    }
+
+    void WriteStringCall(const char* const value)
+    {
+        calls.push_back("string " + std::string{value});
+        wire.insert(wire.end(), value, value + std::strlen(value) + 1);
+    }
+
+    void WriteEntityCall(const int value)
+    {
+        calls.push_back("entity " + std::to_string(value));
+        Put(value, 2);
+    }
+
+    void AlertMessageCall(AlertType, const char*, ...)
+    {
+    }
+
+    void Clear()
+    {
+        calls.clear();
+        wire.clear();
+    }
+
+    MessageBuilder Build()
+    {
+        MessageBuilder message{77};
+        message.WriteByte(200).WriteChar(-3).WriteShort(-2).WriteLong(0x12345678).WriteAngle(93.7F);
+        message.WriteCoord(Vector{-123.4F, 5.5F, 4000.1F}).WriteString("hello").WriteString(nullptr).WriteEntity(31);
+
+        return message;
+    }
+
+    const std::vector<std::string> expected_calls{
+        "begin 2 77", "byte 200", "char -3", "short -2", "long 305419896", "angle " + std::to_string(93.7F),
+        "coord " + std::to_string(-123.4F), "coord " + std::to_string(5.5F), "coord " + std::to_string(4000.1F),
+        "string hello", "string ", "entity 31", "end"};
+
+    void TestFields()
+    {
+        const auto message = Build();
+
+        Clear();
+        message.Send(MessageType::All, nullptr, nullptr, MessageReplay::Fields);
+        META_CHECK(calls == expected_calls);
+
+        // The prepared bytes are the bytes the engine puts on the wire.
+        META_CHECK(wire.size() == message.Size());
+        META_CHECK(std::memcmp(wire.data(), message.Data(), wire.size()) == 0);
+    }
+
+    void TestPacked()
+    {
+        const auto message = Build();
+
+        Clear();
+        message.Send(MessageType::All, nullptr, nullptr, MessageReplay::Fields);
+        const auto fields_wire = wire;
+
+        // Messages are packed by default.
+        Clear();
+        message.Send(MessageType::All);
+        META_CHECK(wire == fields_wire);
+        META_CHECK(calls.size() == 2 + (message.Size() + 3) / 4);
+        META_CHECK(calls.front() == expected_calls.front());
+    }
+
+    void OnMessage(metamod::engine::InterceptedMessage&)
+    {
+    }
+
+    /**
+     * @brief Messages intercepted by this plugin are replayed field by field, so the handlers can decode them.
+    */
+    void TestAuto()
+    {
+        const auto message = Build();
+        HookMessage(message.MsgId(), &OnMessage);
+
+        Clear();
+        message.Send(MessageType::All);
+        META_CHECK(calls == expected_calls);
+
+        std::vector<std::uint8_t> buffer{};
+        META_CHECK(message.Save(buffer) == MessageReplay::Fields);
+
+        UnhookMessage(message.MsgId(), &OnMessage);
+        META_CHECK(message.Save(buffer) == MessageReplay::Packed);
+    }
+
+    void TestSaveFields()
+    {
+        const auto message = Build();
+        std::vector<std::uint8_t> buffer{};
+        META_CHECK(message.Save(buffer, MessageReplay::Fields) == MessageReplay::Fields);
+
+        Clear();
+        MessageBegin(MessageType::All, message.MsgId());
+        WriteSavedMessage(buffer.data(), buffer.size(), MessageReplay::Fields);
+        MessageEnd();
+        META_CHECK(calls == expected_calls);
+
+        // Saved messages are appended to the buffer.
+        const auto first_size = buffer.size();
+        MessageBuilder second{78};
+        second.WriteShort(1000).WriteString("x");
+        second.Save(buffer, MessageReplay::Fields);
+
+        Clear();
+        WriteSavedMessage(&buffer[first_size], buffer.size() - first_size, MessageReplay::Fields);
+        META_CHECK((calls == std::vector<std::string>{"short 1000", "string x"}));
+    }
+
+    void TestSavePacked()
+    {
+        const auto message = Build();
+        std::vector<std::uint8_t> buffer{};
+        META_CHECK(message.Save(buffer) == MessageReplay::Packed);
+        META_CHECK(buffer.size() == message.Size());
+
+        Clear();
+        WriteSavedMessage(buffer.data(), buffer.size(), MessageReplay::Packed);
+        META_CHECK(wire.size() == message.Size());
+        META_CHECK(std::memcmp(wire.data(), message.Data(), wire.size()) == 0);
+    }
+
+    void TestOverflow()
+    {
+        MessageBuilder message{77};
+
+        // The engine's limit for user messages.
+        for (std::size_t i = 0; i < 192 / 4; ++i) {
+            message.WriteLong(0);
+        }
+
+        META_CHECK(!message.Overflowed());
+
+        message.WriteByte(0);
+        META_CHECK(message.Overflowed());
+        META_CHECK(message.Size() == 192);
+
+        Clear();
+        message.Send(MessageType::All);
+        META_CHECK(calls.empty());
+
+        message.Reset(77);
+        META_CHECK(!message.Overflowed());
+        META_CHECK(message.Size() == 0);
+    }
+}
+
+int main()
+{
+    metamod::g_globals = &globals;
+
+    auto& engine = g_engine_funcs;
+    engine.message_begin = &MessageBeginCall;
+    engine.message_end = &MessageEndCall;
+    engine.write_byte = &WriteByteCall;
+    engine.write_char = &WriteCharCall;
+    engine.write_short = &WriteShortCall;
+    engine.write_long = &WriteLongCall;
+    engine.write_angle = &WriteAngleCall;
+    engine.write_coord = &WriteCoordCall;
+    engine.write_string = &WriteStringCall;
+    engine.write_entity = &WriteEntityCall;
+    engine.alert_message = &AlertMessageCall;
+
+    TestFields();
+    TestPacked();
+    TestAuto();
+    TestSaveFields();
+    TestSavePacked();
+    TestOverflow();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/multicast.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    constexpr auto MAX_CLIENTS = 8;
+
+    Globals globals{};
+    GlobalVars global_vars{};
+    Edict entities[MAX_CLIENTS + 1]{};
+    int lookups{};
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    Edict* EntityOfIndex(const int index)
+    {
+        ++lookups;
+        return &entities[index];
+    }
+
+    void Connect(const int index)
+    {
+        constexpr qboolean accepted = 1;
+        globals.orig_ret = &accepted;
+        globals.status = Result::Ignored;
+
+        gamedll::detail::dll_post_hooks->client_connect(&entities[index], "name", "address", nullptr);
+    }
+
+    void TestReceivingClients()
+    {
+        // A bot and a human that are in the server already.
+        entities[1].vars.flags = FL_CLIENT | FL_FAKE_CLIENT;
+        entities[2].vars.flags = FL_CLIENT;
+        META_CHECK(ReceivingClients() == ClientBit(2));
+
+        // The client slots are looked up only when the roster is built.
+        lookups = 0;
+        Connect(5);
+        META_CHECK(ReceivingClients() == ClientBit(2));
+
+        entities[5].vars.flags = FL_CLIENT;
+        gamedll::detail::dll_post_hooks->client_put_in_server(&entities[5]);
+        META_CHECK(ReceivingClients() == (ClientBit(2) | ClientBit(5)));
+
+        gamedll::detail::dll_post_hooks->client_disconnect(&entities[2]);
+        META_CHECK(ReceivingClients() == ClientBit(5));
+        META_CHECK(lookups == 0);
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_global_vars = &global_vars;
+    global_vars.max_clients = MAX_CLIENTS;
+
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+    g_engine_funcs.entity_of_ent_index = &EntityOfIndex;
+
+    TestReceivingClients();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
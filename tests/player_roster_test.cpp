@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/player_roster.h>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::gamedll;
+
+namespace
+{
+    constexpr auto MAX_CLIENTS = 8;
+
+    Globals globals{};
+    GlobalVars global_vars{};
+    Edict entities[MAX_CLIENTS + 1]{};
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    Edict* EntityOfIndex(const int index)
+    {
+        return &entities[index];
+    }
+
+    void Connect(const int index)
+    {
+        constexpr qboolean accepted = 1;
+        globals.orig_ret = &accepted;
+        globals.status = Result::Ignored;
+
+        gamedll::detail::dll_post_hooks->client_connect(&entities[index], "name", "address", nullptr);
+    }
+
+    /**
+     * @brief Creates a bot the way the game DLL does: \c ClientPutInServer is called without the hooks.
+    */
+    void CreateBot(const int index)
+    {
+        Edict* bot = &entities[index];
+        globals.orig_ret = &bot;
+        entities[index].vars.flags = FL_CLIENT | FL_FAKE_CLIENT;
+
+        engine::detail::engine_post_hooks->create_fake_client("bot");
+    }
+
+    void TestExistingPlayers()
+    {
+        entities[1].vars.flags = FL_CLIENT;
+
+        META_CHECK(Roster().size() == 1);
+        META_CHECK(GetPlayerState(1) == PlayerState::InGame);
+        META_CHECK(GetPlayerState(2) == PlayerState::Free);
+    }
+
+    void TestConnect()
+    {
+        Connect(2);
+        META_CHECK(GetPlayerState(2) == PlayerState::Connected);
+        META_CHECK(CountPlayers() == 1);
+        META_CHECK(CountPlayers({true}) == 2);
+
+        entities[2].vars.flags = FL_CLIENT;
+        gamedll::detail::dll_post_hooks->client_put_in_server(&entities[2]);
+        META_CHECK(GetPlayerState(2) == PlayerState::InGame);
+        META_CHECK(CountPlayers() == 2);
+    }
+
+    void TestBotsWithoutHooks()
+    {
+        CreateBot(3);
+
+        // The bot is added on the next frame.
+        gamedll::detail::dll_post_hooks->start_frame();
+        META_CHECK(GetPlayerState(3) == PlayerState::InGame);
+        META_CHECK(CountPlayers({false, true, false}) == 1);
+        META_CHECK(CountPlayers({false, false, true}) == 2);
+
+        // Players that are connecting are not put in game by the scan.
+        Connect(4);
+        entities[4].vars.flags = FL_CLIENT;
+        CreateBot(5);
+        gamedll::detail::dll_post_hooks->start_frame();
+        META_CHECK(GetPlayerState(4) == PlayerState::Connected);
+        META_CHECK(GetPlayerState(5) == PlayerState::InGame);
+    }
+
+    void TestMapChange()
+    {
+        gamedll::detail::dll_post_hooks->server_deactivate();
+        META_CHECK(GetPlayerState(3) == PlayerState::Connected);
+
+        // A bot of the game DLL is put in the server again without the hooks.
+        gamedll::detail::dll_post_hooks->server_activate(entities, MAX_CLIENTS + 1, MAX_CLIENTS);
+        META_CHECK(GetPlayerState(3) == PlayerState::InGame);
+        META_CHECK(GetPlayerState(5) == PlayerState::InGame);
+        META_CHECK(GetPlayerState(1) == PlayerState::Connected);
+
+        gamedll::detail::dll_post_hooks->client_disconnect(&entities[3]);
+        entities[3] = {};
+        META_CHECK(GetPlayerState(3) == PlayerState::Free);
+        META_CHECK(Roster().size() == 4);
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_global_vars = &global_vars;
+    global_vars.max_clients = MAX_CLIENTS;
+
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+    g_engine_funcs.entity_of_ent_index = &EntityOfIndex;
+
+    TestExistingPlayers();
+    TestConnect();
+    TestBotsWithoutHooks();
+    TestMapChange();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
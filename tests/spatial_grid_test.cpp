@@ -0,0 +1,190 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/api.h>
+#include <metamod/engine_hooks.h>
+#include <metamod/gamedll_hooks.h>
+#include <metamod/spatial_grid.h>
+#include <algorithm>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod;
+using namespace metamod::engine;
+
+namespace
+{
+    constexpr auto MAX_ENTITIES = 16;
+
+    Globals globals{};
+    GlobalVars global_vars{};
+    Edict entities[MAX_ENTITIES]{};
+    int private_data{};
+    int lookups{};
+
+    int IndexOfEntity(const Edict* const entity)
+    {
+        return static_cast<int>(entity - entities);
+    }
+
+    Edict* EntityOfIndex(const int index)
+    {
+        ++lookups;
+        return &entities[index];
+    }
+
+    /**
+     * @brief Moves the entity without calling the engine, the way the physics does.
+    */
+    void Move(const int index, const float x, const float y)
+    {
+        auto& vars = entities[index].vars;
+        vars.origin = {x, y, 0.F};
+        vars.abs_min = {x - 17.F, y - 17.F, -17.F};
+        vars.abs_max = {x + 17.F, y + 17.F, 17.F};
+    }
+
+    /**
+     * @brief Creates an entity and places it with \c SetOrigin.
+    */
+    void Place(const int index, const float x, const float y, const MoveTypeEntity move_type = MoveTypeEntity::None)
+    {
+        auto& entity = entities[index];
+        entity.free = 0;
+        entity.private_data = &private_data;
+        entity.vars.classname = Strind(1);
+        entity.vars.move_type = move_type;
+        entity.vars.min_size = {-16.F, -16.F, -16.F};
+        entity.vars.max_size = {16.F, 16.F, 16.F};
+        Move(index, x, y);
+
+        engine::detail::engine_post_hooks->set_origin(&entity, entity.vars.origin);
+    }
+
+    std::vector<int> InSphere(const float x, const float y, const float radius)
+    {
+        std::vector<Edict*> found{};
+        FindEntitiesInSphere({x, y, 0.F}, radius, found);
+
+        std::vector<int> indices{};
+
+        for (const auto* const entity : found) {
+            indices.push_back(IndexOfEntity(entity));
+        }
+
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    void StartFrame()
+    {
+        gamedll::detail::dll_hooks->start_frame();
+    }
+
+    void TestQueries()
+    {
+        // The grid is built on the first query.
+        META_CHECK(InSphere(0.F, 0.F, 100.F).empty());
+
+        Place(1, 0.F, 0.F);
+        Place(2, 1000.F, 0.F);
+
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1}));
+        META_CHECK((InSphere(1000.F, 50.F, 100.F) == std::vector{2}));
+
+        std::vector<Edict*> found{};
+        FindEntitiesInBox({-50.F, -50.F, -50.F}, {1050.F, 50.F, 50.F}, found);
+        META_CHECK(found.size() == 2);
+
+        // Stationary entities are moved by the hooks.
+        Place(2, 50.F, 0.F);
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1, 2}));
+    }
+
+    void TestPhysics()
+    {
+        Place(3, 3000.F, 0.F, MoveTypeEntity::Toss);
+        Move(3, 0.F, -50.F);
+        entities[3].vars.velocity = {300.F, 0.F, 0.F};
+
+        // Only the entities with a move type are visited.
+        lookups = 0;
+        StartFrame();
+        META_CHECK(lookups == 1);
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1, 2, 3}));
+
+        // The entity stops; it is no longer visited.
+        entities[3].vars.move_type = MoveTypeEntity::None;
+        StartFrame();
+
+        lookups = 0;
+        StartFrame();
+        META_CHECK(lookups == 0);
+    }
+
+    void TestCreatedEntities()
+    {
+        // Created by the game DLL and placed without SetOrigin.
+        auto* created = &entities[4];
+        created->private_data = &private_data;
+        created->vars.classname = Strind(1);
+        Move(4, 0.F, 60.F);
+
+        globals.orig_ret = &created;
+        engine::detail::engine_post_hooks->create_entity();
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1, 2, 3}));
+
+        StartFrame();
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1, 2, 3, 4}));
+    }
+
+    void TestSkippedEntities()
+    {
+        // Like FindEntityInSphere, entities without a class name and freed entities are skipped.
+        entities[4].vars.classname = Strind(0);
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{1, 2, 3}));
+
+        gamedll::detail::dll_new_post_hooks->free_entity_private_data(&entities[1]);
+        entities[1].private_data = nullptr;
+        entities[1].free = 1;
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{2, 3}));
+
+        // The slot is reused far away.
+        Place(1, 2000.F, 2000.F);
+        META_CHECK((InSphere(0.F, 0.F, 100.F) == std::vector{2, 3}));
+        META_CHECK((InSphere(2000.F, 2000.F, 10.F) == std::vector{1}));
+    }
+}
+
+int main()
+{
+    g_globals = &globals;
+    g_global_vars = &global_vars;
+    global_vars.max_entities = MAX_ENTITIES;
+    global_vars.frame_time = 0.1F;
+
+    g_engine_funcs.index_of_edict = &IndexOfEntity;
+    g_engine_funcs.entity_of_ent_index = &EntityOfIndex;
+
+    TestQueries();
+    TestPhysics();
+    TestCreatedEntities();
+    TestSkippedEntities();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (C) 2020 the_hunter
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test.h"
+#include <metamod/user_message.h>
+#include <metamod/utils.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cssdk;
+using namespace metamod::engine;
+
+namespace
+{
+    namespace fields = metamod::engine::field;
+
+    using ScoreInfo = UserMessage<fields::Byte, fields::Short, fields::Short>;
+    using StatusText = UserMessage<fields::Byte, fields::String>;
+
+    /**
+     * @brief Engine calls of the sent messages, one entry per call.
+    */
+    std::vector<std::string> calls{};
+
+    int alerts{};
+
+    void MessageBeginCall(const MessageType msg_type, const int msg_id, const float*, Edict*)
+    {
+        calls.push_back("begin " + std::to_string(static_cast<int>(msg_type)) + " " + std::to_string(msg_id));
+    }
+
+    void MessageEndCall()
+    {
+        calls.emplace_back("end");
+    }
+
+    void WriteByteCall(const int value)
+    {
+        calls.push_back("byte " + std::to_string(value));
+    }
+
+    void WriteShortCall(const int value)
+    {
+        calls.push_back("short " + std::to_string(value));
+    }
+
+    void WriteStringCall(const char* const value)
+    {
+        calls.push_back("string " + std::string{value});
+    }
+
+    void AlertMessageCall(AlertType, const char*, ...)
+    {
+        ++alerts;
+    }
+
+    int RegUserMessageCall(const char*, const int size)
+    {
+        return size == 5 ? 90 : 0;
+    }
+
+    int GetUserMsgIdCall(metamod::PluginInfo*, const char* const name, int* const size)
+    {
+        if (std::strcmp(name, "ScoreInfo") != 0) {
+            return 0;
+        }
+
+        if (size != nullptr) {
+            *size = 5;
+        }
+
+        return 85;
+    }
+
+    void TestRegister()
+    {
+        ScoreInfo score_info{};
+        META_CHECK(ScoreInfo::SIZE == 5);
+        META_CHECK(StatusText::SIZE == -1);
+
+        META_CHECK(score_info.Register("ScoreInfo"));
+        META_CHECK(score_info.Id() == 90);
+
+        calls.clear();
+        score_info.Send(MessageType::All, nullptr, 1, -2, 300);
+        META_CHECK((calls == std::vector<std::string>{"begin 2 90", "byte 1", "short -2", "short 300", "end"}));
+
+        // A failed registration leaves the message unusable.
+        StatusText status_text{};
+        META_CHECK(!status_text.Register("StatusText"));
+        META_CHECK(status_text.Id() == 0);
+    }
+
+    void TestFind()
+    {
+        ScoreInfo score_info{};
+        META_CHECK(score_info.Find("ScoreInfo"));
+        META_CHECK(score_info.Id() == 85);
+
+        // The registered size does not match the layout.
+        alerts = 0;
+        StatusText wrong_size{};
+        META_CHECK(!wrong_size.Find("ScoreInfo"));
+        META_CHECK(wrong_size.Id() == 0);
+        META_CHECK(alerts == 1);
+
+        StatusText missing{};
+        META_CHECK(!missing.Find("Missing"));
+        META_CHECK(missing.Id() == 0);
+    }
+
+    /**
+     * @brief Message ID 0 is svc_bad; a message that was not registered or found is never sent.
+    */
+    void TestUnregisteredSend()
+    {
+        StatusText status_text{};
+        status_text.Find("Missing");
+
+        calls.clear();
+        alerts = 0;
+        status_text.Send(MessageType::All, nullptr, 1, "text");
+        status_text.Send(ClientMask{1}, true, 1, "text");
+        META_CHECK(calls.empty());
+        META_CHECK(alerts == 2);
+    }
+
+    void TestEncode()
+    {
+        ScoreInfo score_info{};
+        score_info.Register("ScoreInfo");
+
+        MessageBuilder builder{};
+        score_info.Encode(builder, 1, 2, 3);
+        META_CHECK(builder.MsgId() == 90);
+        META_CHECK(builder.Size() == 5);
+    }
+}
+
+int main()
+{
+    auto& engine = g_engine_funcs;
+    engine.message_begin = &MessageBeginCall;
+    engine.message_end = &MessageEndCall;
+    engine.write_byte = &WriteByteCall;
+    engine.write_short = &WriteShortCall;
+    engine.write_string = &WriteStringCall;
+    engine.alert_message = &AlertMessageCall;
+    engine.reg_user_message = &RegUserMessageCall;
+
+    metamod::utils::detail::Funcs funcs{};
+    funcs.get_user_msg_id = &GetUserMsgIdCall;
+    metamod::utils::detail::funcs = &funcs;
+
+    TestRegister();
+    TestFind();
+    TestUnregisteredSend();
+    TestEncode();
+
+    return metamod::test::failures == 0 ? 0 : 1;
+}